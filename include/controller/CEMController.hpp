@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_CONTROLLER_CEMCONTROLLER_HPP_
+#define INCLUDE_CONTROLLER_CEMCONTROLLER_HPP_
+
+#include <Eigen/Dense>
+#include <functional>
+#include <memory>
+#include <random>
+#include "actionspace/ActionSpace.hpp"
+#include "model/Model.hpp"
+#include "model/RolloutEngine.hpp"
+
+namespace libcozmo {
+namespace controller {
+
+/// This class implements a receding horizon controller based on the
+/// cross-entropy method (CEM) over a discrete action space.
+///
+/// The controller keeps one categorical distribution over the action ids per
+/// timestep of the horizon. Every iteration samples action sequences from
+/// these distributions, rolls them out through the model (batched per
+/// timestep and in parallel across sequences) and refits the distributions
+/// to the lowest cost (elite) sequences.
+///
+/// Between control steps the distributions are kept, so the next solve is
+/// warm started from the previous solution; call shift() after executing the
+/// first action of a solution to advance the horizon by one step.
+class CEMController {
+ public:
+    /// Computes the cost of each rolled out sequence
+    ///
+    /// \param rollouts The visited states
+    /// \param action_ids The action sequences, one per row
+    /// \param[out] costs Cost of each sequence
+    typedef std::function<void(
+        const model::Rollouts& rollouts,
+        const Eigen::MatrixXi& action_ids,
+        Eigen::VectorXd* costs)> CostFunction;
+
+    /// Tuning parameters of the controller
+    struct Parameters {
+        Parameters() :
+            horizon(5),
+            num_samples(256),
+            num_elites(25),
+            max_iterations(10),
+            smoothing(0.7),
+            time_budget(0.02),
+            seed(0) {}
+
+        /// Number of actions in a sequence
+        int horizon;
+        /// Number of sequences sampled per iteration
+        int num_samples;
+        /// Number of lowest cost sequences the distribution is fit to
+        int num_elites;
+        /// Maximum number of iterations per solve
+        int max_iterations;
+        /// Weight of the elite frequencies when updating the distribution,
+        /// in (0, 1]
+        double smoothing;
+        /// Wall clock budget of one solve (seconds); if not positive, all
+        /// iterations are run
+        double time_budget;
+        /// Seed of the random number generator
+        unsigned int seed;
+    };
+
+    /// Result of one solve
+    struct Solution {
+        /// Best action sequence found
+        Eigen::VectorXi action_ids;
+        /// Cost of the best action sequence
+        double cost;
+        /// Number of completed iterations
+        int num_iterations;
+        /// Wall clock time of the solve (seconds)
+        double seconds;
+    };
+
+    /// Constructs the controller
+    ///
+    /// \param model The model that predicts the next state
+    /// \param actionspace The action space to sample action ids from
+    /// \param cost The cost of rolled out sequences
+    /// \param parameters Tuning parameters
+    /// \param num_threads Number of worker threads; if not positive, the
+    /// number of hardware threads is used
+    CEMController(
+        const std::shared_ptr<model::Model> model,
+        const actionspace::ActionSpace& actionspace,
+        const CostFunction& cost,
+        const Parameters& parameters = Parameters(),
+        const int& num_threads = 0);
+
+    ~CEMController() = default;
+
+    /// Optimizes the action sequence from the given state. Iterations stop
+    /// after max_iterations or when the next iteration is expected to exceed
+    /// the time budget; at least one iteration is always run
+    ///
+    /// \param state The current state vector
+    /// \param[out] solution The best action sequence found
+    /// \return True if an action sequence was found; false otherwise
+    bool solve(const Eigen::VectorXd& state, Solution* solution);
+
+    /// Advances the horizon by one step after the first action of the last
+    /// solution was executed. The distributions and the best sequence are
+    /// shifted; the new last timestep is reset to uniform
+    void shift();
+
+    /// Forgets the previous solutions
+    void reset();
+
+    /// Gets the categorical distributions, row t holds the probability of
+    /// each action id at timestep t
+    const Eigen::MatrixXd& distribution() const;
+
+    /// Creates a cost that sums over all timesteps the weighted distance
+    /// between the SE2 state [x, y, theta] and the goal state:
+    /// translation_weight * ||[x, y] - goal|| + rotation_weight * |dtheta|
+    /// where dtheta is the shortest angle between the orientations
+    ///
+    /// \param goal The goal state vector
+    /// \param translation_weight Weight of the translation error
+    /// \param rotation_weight Weight of the orientation error
+    /// \return The cost function
+    static CostFunction goal_cost(
+        const Eigen::Vector3d& goal,
+        const double& translation_weight,
+        const double& rotation_weight);
+
+ private:
+    /// Samples action sequences from the distributions; the first row is
+    /// the best sequence found so far if there is one
+    ///
+    /// \param[out] action_ids The sampled sequences, one per row
+    void sample(Eigen::MatrixXi* action_ids);
+
+    const model::RolloutEngine m_engine;
+    const CostFunction m_cost;
+    const Parameters m_parameters;
+    const int m_num_actions;
+
+    Eigen::MatrixXd m_distribution;
+    Eigen::VectorXi m_best;
+    bool m_has_best;
+    std::mt19937 m_generator;
+};
+
+}  // namespace controller
+}  // namespace libcozmo
+
+#endif  // INCLUDE_CONTROLLER_CEMCONTROLLER_HPP_
@@ -33,6 +33,7 @@
 #include <memory>
 #include "statespace/SE2.hpp"
 #include "distance/distance.hpp"
+#include "distance/distance_table.hpp"
 
 namespace libcozmo {
 namespace distance {
@@ -47,6 +48,14 @@ class SE2 : public Distance {
     /// \param statespace The statespace the metric operates in
     explicit SE2(const std::shared_ptr<statespace::SE2> statespace);
 
+    /// Constructs metric that looks distances up in a precomputed table
+    ///
+    /// \param statespace The statespace the metric operates in
+    /// \param table Distance table built for the same statespace
+    SE2(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<const DistanceTable> table);
+
     ~SE2() {}
 
     /// Documentation inherited
@@ -54,8 +63,15 @@ class SE2 : public Distance {
         const statespace::StateSpace::State& _state_1,
         const statespace::StateSpace::State& _state_2) const override;
 
+    /// Documentation inherited
+    void get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const override;
+
  private:
     const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<const DistanceTable> m_table;
 };
 
 }  // namespace distance
@@ -30,6 +30,7 @@
 #ifndef LIBCOZMO_DISTANCE_DISTANCE_HPP_
 #define LIBCOZMO_DISTANCE_DISTANCE_HPP_
 
+#include <Eigen/Dense>
 #include "statespace/StateSpace.hpp"
 
 namespace libcozmo {
@@ -46,6 +47,26 @@ class Distance {
     virtual double get_distance(
         const libcozmo::statespace::StateSpace::State& _state_1,
         const libcozmo::statespace::StateSpace::State& _state_2) const = 0;
+
+    /// Calculates the distances between a state and many states at once
+    ///
+    /// Only defined for discrete SE2 states: the states are given by their
+    /// cells [x, y, theta], one state per row, so each coordinate is a
+    /// contiguous column. Every distance equals get_distance() of the query
+    /// and the statespace::SE2::State in the same row. By default this
+    /// function calls get_distance() for every row; derived classes that
+    /// can evaluate the batch with array operations should override it
+    ///
+    /// Throws an invalid_argument exception if the states do not have 3
+    /// columns
+    ///
+    /// \param _state The query state
+    /// \param _states Discrete coordinates of the states, one per row
+    /// \param[out] _distances The distance to each state
+    virtual void get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const;
 };
 
 }  // namespace distance
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LIBCOZMO_DISTANCE_DISTANCE_TABLE_HPP_
+#define LIBCOZMO_DISTANCE_DISTANCE_TABLE_HPP_
+
+#include <memory>
+#include <vector>
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+/// Precomputed SE2 distances indexed by discrete state deltas
+///
+/// For a fixed resolution the SE2 distance between two discrete states
+/// only depends on (|dx|, |dy|, dtheta mod N), where N is the number of
+/// theta bins. This class stores the distance for every delta with
+/// |dx|, |dy| <= radius, so a lookup near the query is one table load;
+/// larger deltas are computed in closed form.
+class DistanceTable {
+ public:
+    /// Constructs the table for the given statespace
+    ///
+    /// \param statespace The statespace the distances are defined in
+    /// \param radius Largest |dx| and |dy| (in cells) stored in the table
+    DistanceTable(
+        const std::shared_ptr<statespace::SE2> statespace, const int& radius);
+
+    ~DistanceTable() {}
+
+    /// Gets the distance of a delta between two discrete states
+    ///
+    /// \param dx, dy Position delta in cells
+    /// \param dtheta Theta delta in bins, any sign
+    /// \return Distance between the states
+    double get_distance(const int& dx, const int& dy, const int& dtheta) const;
+
+    /// Gets the distance between two discrete states
+    ///
+    /// \param _state_1, _state_2 The discrete states
+    /// \return Distance between the states
+    double get_distance(
+        const statespace::SE2::State& _state_1,
+        const statespace::SE2::State& _state_2) const;
+
+    /// Computes the distance of a delta without the table
+    ///
+    /// \param dx, dy Position delta in cells
+    /// \param dtheta Theta delta in bins, any sign
+    /// \return Distance between the states
+    double compute_distance(
+        const int& dx, const int& dy, const int& dtheta) const;
+
+    /// Whether a position delta is stored in the table
+    bool contains(const int& dx, const int& dy) const;
+
+    /// Gets the radius of the table in cells
+    int get_radius() const;
+
+    /// Gets the resolution of the statespace the table was built for
+    double get_resolution() const;
+
+    /// Gets the number of theta bins of the statespace
+    int get_num_theta_vals() const;
+
+ private:
+    /// Returns theta delta wrapped to [0, num_theta_vals)
+    int wrap_theta(const int& dtheta) const;
+
+    const double m_resolution;
+    const int m_num_theta_vals;
+    const int m_radius;
+
+    /// Flattened [|dx|][|dy|][dtheta] table
+    std::vector<double> m_table;
+};
+
+}  // namespace distance
+}  // namespace libcozmo
+
+#endif  // LIBCOZMO_DISTANCE_DISTANCE_TABLE_HPP_
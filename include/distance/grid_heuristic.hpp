@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef LIBCOZMO_DISTANCE_GRID_HEURISTIC_HPP_
+#define LIBCOZMO_DISTANCE_GRID_HEURISTIC_HPP_
+
+#include <memory>
+#include <vector>
+#include "statespace/SE2.hpp"
+#include "distance/distance.hpp"
+#include "planner/DaryHeap.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+/// Heuristic distance to a goal around obstacles in the workspace
+///
+/// The workspace is a bounded 2D grid of the (x, y) cells of the SE2
+/// statespace, e.g. the table top bounded by its detected edges, in which
+/// cells can be marked occupied. For a goal, the shortest 8-connected path
+/// length (meters) from every free cell to the goal cell is computed once
+/// by a backward Dijkstra search; diagonal steps may not cut the corner of
+/// an occupied cell. The distance between a state and the goal state is
+/// then a table lookup, infinite for cells that are occupied, outside the
+/// workspace or cut off from the goal. Other pairs of states get their
+/// translation distance, as in Translation.
+///
+/// When cells change after the goal is set, only the path lengths that
+/// depend on them are repaired (as in lifelong planning A*), so the work
+/// grows with the affected area rather than with the workspace.
+///
+/// Headings are ignored. Since 8-connected paths are up to 8% longer than
+/// straight lines, the heuristic may slightly overestimate in free space.
+class GridHeuristic : public virtual Distance {
+ public:
+    /// Constructs metric with given statespace and workspace bounds
+    ///
+    /// \param statespace The statespace the metric operates in
+    /// \param min_x, min_y Smallest cell coordinates of the workspace
+    /// \param max_x, max_y Largest cell coordinates of the workspace
+    GridHeuristic(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const int& min_x,
+        const int& min_y,
+        const int& max_x,
+        const int& max_y);
+    ~GridHeuristic() {}
+
+    /// Documentation inherited
+    double get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2) const override;
+
+    /// Documentation inherited
+    void get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const override;
+
+    /// Computes the path lengths to a goal
+    ///
+    /// \param goal The goal state; its heading is ignored
+    /// \return True if the goal is in the workspace; false otherwise
+    bool set_goal(const statespace::SE2::State& goal);
+
+    /// Marks a cell as occupied or free, repairing the path lengths if a
+    /// goal is set
+    ///
+    /// \param x, y Coordinates of the cell
+    /// \param occupied Whether the cell is occupied
+    /// \return True if the cell is in the workspace; false otherwise
+    bool set_occupied(const int& x, const int& y, const bool& occupied);
+
+    /// Whether a cell is occupied; cells outside the workspace are
+    bool is_occupied(const int& x, const int& y) const;
+
+    /// Gets the path length from a cell to the goal cell (meters)
+    ///
+    /// \param x, y Coordinates of the cell
+    /// \return The path length; infinite if no goal is set or the cell is
+    /// occupied, outside the workspace or cut off from the goal
+    double get_cost_to_goal(const int& x, const int& y) const;
+
+    /// Gets the number of cells processed by the last goal change or
+    /// repair
+    int get_num_updated_cells() const;
+
+ private:
+    /// Gets the index of a cell; -1 if outside the workspace
+    int index(const int& x, const int& y) const;
+
+    /// Whether the goal cell is the cell of a state
+    bool is_goal(const statespace::SE2::State& state) const;
+
+    /// Recomputes the one step lookahead path length of a cell and queues
+    /// it if it is inconsistent
+    void update_cell(const int& cell);
+
+    /// Processes inconsistent cells until every cell is consistent
+    void propagate();
+
+    /// Calls a function with every neighbor of a cell and the step cost
+    template <typename Function>
+    void for_each_neighbor(const int& cell, Function function) const;
+
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const int m_min_x;
+    const int m_min_y;
+    const int m_width;
+    const int m_height;
+    const double m_resolution;
+
+    std::vector<bool> m_occupied;
+    /// Path length to the goal found by the last expansion of each cell
+    std::vector<double> m_g;
+    /// One step lookahead path length to the goal of each cell
+    std::vector<double> m_rhs;
+    planner::DaryHeap<double> m_open;
+    /// Index of the goal cell; -1 if no goal is set
+    int m_goal;
+    int m_num_updated_cells;
+};
+
+}  // namespace distance
+}  // namespace libcozmo
+
+#endif  // LIBCOZMO_DISTANCE_GRID_HEURISTIC_HPP_
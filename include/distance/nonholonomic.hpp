@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LIBCOZMO_DISTANCE_NONHOLONOMIC_HPP_
+#define LIBCOZMO_DISTANCE_NONHOLONOMIC_HPP_
+
+#include <memory>
+#include <vector>
+#include "statespace/SE2.hpp"
+#include "distance/distance.hpp"
+#include "utils/HeadingTable.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+/// Base class of path length metrics for curvature constrained vehicles
+///
+/// The distance between two states is the length of the shortest path of
+/// a vehicle with a minimum turning radius. It only depends on the pose of
+/// the second state relative to the first, so lengths for every discrete
+/// relative pose with |dx|, |dy| <= table radius are precomputed and a
+/// query is one table load; larger offsets are computed in closed form.
+class Nonholonomic : public virtual Distance {
+ public:
+    /// Length of the shortest path for a unit turning radius
+    ///
+    /// \param x, y Position of the goal in the frame of the start
+    /// \param phi Heading of the goal relative to the start
+    typedef double (*PathLength)(double x, double y, double phi);
+
+    virtual ~Nonholonomic() {}
+
+    /// Documentation inherited
+    double get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2) const override;
+
+    /// Documentation inherited
+    void get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const override;
+
+    /// Computes the path length between two discrete states without the
+    /// lookup table
+    ///
+    /// \param _state_1, _state_2 The discrete states
+    /// \return Length of the shortest path
+    double compute_distance(
+        const statespace::SE2::State& _state_1,
+        const statespace::SE2::State& _state_2) const;
+
+    /// Gets the minimum turning radius
+    double get_turning_radius() const;
+
+    /// Gets the radius of the lookup table in cells
+    int get_table_radius() const;
+
+ protected:
+    /// Constructs metric and fills the lookup table
+    ///
+    /// \param statespace The statespace the metric operates in
+    /// \param turning_radius Minimum turning radius, in statespace units
+    /// \param table_radius Largest |dx| and |dy| (in cells) in the table
+    /// \param path_length Shortest path length for a unit turning radius
+    Nonholonomic(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const double& turning_radius,
+        const int& table_radius,
+        PathLength path_length);
+
+ private:
+    /// Computes the path length of a delta between two discrete states
+    ///
+    /// \param dx, dy Position delta in cells
+    /// \param theta_1, theta_2 Theta bins of the two states
+    double compute_distance(
+        const int& dx,
+        const int& dy,
+        const int& theta_1,
+        const int& theta_2) const;
+
+    /// Returns theta wrapped to [0, num_theta_vals)
+    int wrap_theta(const int& theta) const;
+
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const double m_turning_radius;
+    const int m_table_radius;
+    const PathLength m_path_length;
+    const double m_resolution;
+    const int m_num_theta_vals;
+    const std::shared_ptr<const utils::HeadingTable> m_headings;
+
+    /// Flattened [dx][dy][theta_1][theta_2] table
+    std::vector<double> m_table;
+};
+
+}  // namespace distance
+}  // namespace libcozmo
+
+#endif  // LIBCOZMO_DISTANCE_NONHOLONOMIC_HPP_
@@ -33,6 +33,7 @@
 #include <memory>
 #include "statespace/SE2.hpp"
 #include "distance/distance.hpp"
+#include "utils/HeadingTable.hpp"
 
 namespace libcozmo {
 namespace distance {
@@ -55,8 +56,15 @@ class Orientation : public virtual Distance {
         const libcozmo::statespace::StateSpace::State& _state_1,
         const libcozmo::statespace::StateSpace::State& _state_2) const override;
 
+    /// Documentation inherited
+    void get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const override;
+
  private:
     const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<const utils::HeadingTable> m_headings;
 };
 
 }  // namespace distance
@@ -0,0 +1,70 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LIBCOZMO_DISTANCE_REEDS_SHEPP_HPP_
+#define LIBCOZMO_DISTANCE_REEDS_SHEPP_HPP_
+
+#include <memory>
+#include "statespace/SE2.hpp"
+#include "distance/nonholonomic.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+/// Shortest path of a car with a minimum turning radius that can reverse
+///
+/// Reeds-Shepp paths are made of at most five straight or minimum radius
+/// arc segments, each driven forward or in reverse. The metric is
+/// symmetric and never larger than the Dubins distance.
+class ReedsShepp : public Nonholonomic {
+ public:
+    /// Constructs metric with given statespace
+    ///
+    /// \param statespace The statespace the metric operates in
+    /// \param turning_radius Minimum turning radius, in statespace units
+    /// \param table_radius Largest |dx| and |dy| (in cells) in the table
+    ReedsShepp(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const double& turning_radius,
+        const int& table_radius = 16);
+
+    ~ReedsShepp() {}
+
+    /// Length of the shortest path for a unit turning radius
+    ///
+    /// \param x, y Position of the goal in the frame of the start
+    /// \param phi Heading of the goal relative to the start
+    /// \return Path length
+    static double path_length(double x, double y, double phi);
+};
+
+}  // namespace distance
+}  // namespace libcozmo
+
+#endif  // LIBCOZMO_DISTANCE_REEDS_SHEPP_HPP_
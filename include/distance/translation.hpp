@@ -55,6 +55,12 @@ class Translation : public virtual Distance {
         const libcozmo::statespace::StateSpace::State& _state_1,
         const libcozmo::statespace::StateSpace::State& _state_2) const override;
 
+    /// Documentation inherited
+    void get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const override;
+
  private:
     const std::shared_ptr<libcozmo::statespace::StateSpace> m_statespace;
 };
@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LIBCOZMO_DISTANCE_WEIGHTED_SE2_HPP_
+#define LIBCOZMO_DISTANCE_WEIGHTED_SE2_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include "statespace/SE2.hpp"
+#include "distance/distance.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+/// Weighted sum of the translation and orientation metrics
+///
+/// The distance between two states is
+///     translation_weight * Translation + rotation_weight * Orientation
+/// computed directly from the discrete cells. Angular distances are read
+/// from a table over all pairs of theta bins built at construction, so no
+/// continuous conversion or rotation decomposition happens per query.
+class WeightedSE2 : public virtual Distance {
+ public:
+    /// Constructs metric with given statespace and weights
+    ///
+    /// \param statespace The statespace the metric operates in
+    /// \param translation_weight Weight of the translational distance
+    /// \param rotation_weight Weight of the angular distance
+    WeightedSE2(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const double& translation_weight,
+        const double& rotation_weight);
+    ~WeightedSE2() {}
+
+    /// Documentation inherited
+    double get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2) const override;
+
+    /// Documentation inherited
+    void get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const override;
+
+    /// Gets the weight of the translational distance
+    double get_translation_weight() const;
+
+    /// Gets the weight of the angular distance
+    double get_rotation_weight() const;
+
+ private:
+    /// Looks up the angular distance between two theta bins, wrapping bins
+    /// outside [0, num_theta_vals) as the Orientation metric does
+    double orientation_distance(const int& theta_1, const int& theta_2) const;
+
+    /// Returns theta wrapped to [0, num_theta_vals)
+    int wrap_theta(const int& theta) const;
+
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const double m_translation_weight;
+    const double m_rotation_weight;
+    const double m_resolution;
+    const int m_num_theta_vals;
+
+    /// Orientation distance between every pair of theta bins
+    Eigen::MatrixXd m_orientation_table;
+};
+
+}  // namespace distance
+}  // namespace libcozmo
+
+#endif  // LIBCOZMO_DISTANCE_WEIGHTED_SE2_HPP_
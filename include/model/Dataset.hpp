@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_DATASET_HPP_
+#define INCLUDE_MODEL_DATASET_HPP_
+
+#include <Eigen/Dense>
+#include <fstream>
+#include <string>
+
+namespace libcozmo {
+namespace model {
+
+/// This class holds a dataset of logged pushes. Each sample is the action
+/// that was executed, the SE2 state of the object before the action and the
+/// observed SE2 state of the object after the action.
+///
+/// Datasets are stored as text files with one sample per line in the
+/// following comma separated format (lines starting with '#' are ignored):
+/// speed, aspect_ratio, edge_offset, heading_offset,
+/// start_x, start_y, start_theta, end_x, end_y, end_theta
+/// The action is in the ObjectOrientedActionSpace::Action vector format and
+/// the states are in the [x, y, theta] format
+class Dataset {
+ public:
+    /// Constructs empty dataset
+    Dataset() = default;
+
+    /// Constructs dataset from the given file
+    ///
+    /// Throws an invalid_argument exception if the file can't be opened or
+    /// a line can't be parsed
+    ///
+    /// \param dataset_path The path to the dataset file
+    explicit Dataset(const std::string& dataset_path);
+
+    /// Constructs dataset from the given samples
+    ///
+    /// Throws an invalid_argument exception if the matrices don't have the
+    /// same number of rows or the wrong number of columns
+    ///
+    /// \param actions Action vectors, one per row
+    /// \param start_states State vectors before the actions, one per row
+    /// \param end_states State vectors after the actions, one per row
+    Dataset(
+        const Eigen::MatrixXd& actions,
+        const Eigen::MatrixXd& start_states,
+        const Eigen::MatrixXd& end_states);
+
+    ~Dataset() = default;
+
+    /// Appends a sample to the dataset
+    ///
+    /// \param action Action vector
+    /// \param start_state State vector before the action
+    /// \param end_state State vector after the action
+    void add_sample(
+        const Eigen::VectorXd& action,
+        const Eigen::VectorXd& start_state,
+        const Eigen::VectorXd& end_state);
+
+    /// Parses a single line of a dataset file
+    ///
+    /// \param line The line to parse
+    /// \param[out] sample Sample vector in the dataset file format
+    /// \return True if the line is a sample; false if it is a comment, empty
+    /// or malformed
+    static bool parse_line(const std::string& line, Eigen::VectorXd* sample);
+
+    /// Gets the number of samples
+    int size() const;
+
+    /// Gets the action vectors, one per row
+    const Eigen::MatrixXd& actions() const;
+
+    /// Gets the state vectors before the actions, one per row
+    const Eigen::MatrixXd& start_states() const;
+
+    /// Gets the state vectors after the actions, one per row
+    const Eigen::MatrixXd& end_states() const;
+
+    /// Number of elements per sample (action, start state, end state)
+    static constexpr int kSampleSize = 10;
+
+ private:
+    Eigen::MatrixXd m_actions = Eigen::MatrixXd(0, 4);
+    Eigen::MatrixXd m_start_states = Eigen::MatrixXd(0, 3);
+    Eigen::MatrixXd m_end_states = Eigen::MatrixXd(0, 3);
+};
+
+/// This class reads a dataset file in chunks so that datasets larger than
+/// memory can be processed
+class DatasetReader {
+ public:
+    /// Opens the given dataset file
+    ///
+    /// Throws an invalid_argument exception if the file can't be opened
+    ///
+    /// \param dataset_path The path to the dataset file
+    explicit DatasetReader(const std::string& dataset_path);
+
+    ~DatasetReader() = default;
+
+    /// Reads the next samples of the file
+    ///
+    /// Throws an invalid_argument exception if a line can't be parsed
+    ///
+    /// \param max_samples Maximum number of samples to read
+    /// \param[out] chunk The samples read; empty at the end of the file
+    /// \return True if at least one sample was read; false otherwise
+    bool read(const int& max_samples, Dataset* chunk);
+
+ private:
+    std::ifstream m_file;
+    int m_line_number;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_DATASET_HPP_
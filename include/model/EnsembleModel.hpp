@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_ENSEMBLEMODEL_HPP_
+#define INCLUDE_MODEL_ENSEMBLEMODEL_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "model/Model.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// This class combines the predictions of several models of the same action
+/// and state spaces.
+///
+/// Every batch is handed to all members at once; thread safe members run
+/// concurrently on a thread pool while the remaining members (e.g. models
+/// that run inference in the embedded python interpreter) run on the calling
+/// thread. Members that fail are left out of the merge.
+///
+/// State vectors are SE2 states [x, y, theta]. Before merging, the
+/// orientation predicted by each member is unwrapped relative to the first
+/// successful member, and the merged orientation is normalized to [0, 2pi).
+class EnsembleModel : public virtual Model {
+ public:
+    /// How the member predictions are combined
+    enum class MergePolicy {
+        /// Average of the member means; the variance is the variance of the
+        /// mixture of the members (i.e. mean member variance plus the
+        /// disagreement between members)
+        MEAN_VARIANCE,
+        /// Element-wise median of the member means, i.e. each element is
+        /// voted on by the members and is robust to a minority of outliers.
+        /// The variance is the same as for MEAN_VARIANCE
+        MEDIAN
+    };
+
+    /// Timing of the calls made to one member
+    struct MemberStatistics {
+        MemberStatistics() :
+            num_calls(0),
+            num_failures(0),
+            num_samples(0),
+            total_seconds(0.0),
+            max_seconds(0.0) {}
+
+        /// Average duration of one call in seconds
+        double mean_seconds() const {
+            return num_calls > 0 ? total_seconds / num_calls : 0.0;
+        }
+
+        int num_calls;
+        int num_failures;
+        int num_samples;
+        double total_seconds;
+        double max_seconds;
+    };
+
+    /// Constructs the ensemble given its members
+    ///
+    /// \param members The models to combine
+    /// \param policy How member predictions are combined
+    /// \param num_threads Number of worker threads; if not positive, the
+    /// number of hardware threads is used
+    EnsembleModel(
+        const std::vector<std::shared_ptr<Model>>& members,
+        const MergePolicy& policy = MergePolicy::MEAN_VARIANCE,
+        const int& num_threads = 0);
+
+    ~EnsembleModel() = default;
+
+    /// Documentation inherited
+    bool predict_state(
+        const Eigen::VectorXd& input_action,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override;
+
+    /// Documentation inherited
+    bool predict_states(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states) const override;
+
+    /// Documentation inherited
+    bool predict_distribution(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states,
+        Eigen::MatrixXd* output_variances) const override;
+
+    /// Documentation inherited
+    /// The ensemble is thread safe if all of its members are
+    bool is_thread_safe() const override;
+
+    /// Gets the number of members
+    int size() const;
+
+    /// Gets the timing of the calls made to each member, in member order
+    std::vector<MemberStatistics> get_statistics() const;
+
+    /// Resets the timing of all members
+    void reset_statistics();
+
+ private:
+    /// Runs all members on the given batch
+    ///
+    /// \param input_actions Given action vectors, one per row
+    /// \param input_states Given state vectors, one per row
+    /// \param[out] means End state means of each successful member
+    /// \param[out] variances End state variances of each successful member;
+    /// if NULL only the means are predicted
+    /// \return True if at least one member succeeded; false otherwise
+    bool evaluate_members(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        std::vector<Eigen::MatrixXd>* means,
+        std::vector<Eigen::MatrixXd>* variances) const;
+
+    /// Combines the member predictions according to the merge policy
+    ///
+    /// \param means End state means of the members
+    /// \param variances End state variances of the members; may be NULL
+    /// \param[out] output_states Merged end states
+    /// \param[out] output_variances Merged variances; may be NULL
+    void merge(
+        std::vector<Eigen::MatrixXd>* means,
+        const std::vector<Eigen::MatrixXd>* variances,
+        Eigen::MatrixXd* output_states,
+        Eigen::MatrixXd* output_variances) const;
+
+    const std::vector<std::shared_ptr<Model>> m_members;
+    const MergePolicy m_policy;
+    const std::unique_ptr<utils::ThreadPool> m_pool;
+    mutable std::vector<MemberStatistics> m_statistics;
+    mutable std::mutex m_statistics_mutex;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_ENSEMBLEMODEL_HPP_
@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_GPMODEL_HPP_
+#define INCLUDE_MODEL_GPMODEL_HPP_
+
+#include <Eigen/Dense>
+#include "model/Model.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// Base class for Gaussian Process models that are evaluated natively (i.e.
+/// without the embedded python interpreter).
+///
+/// Like GPRModel, these models learn f: a -> Δs where a is an object oriented
+/// action and Δs is the distance the object moved along the action vector and
+/// the change in its orientation. Derived classes only implement inference
+/// on the GP inputs; this class converts actions and states to and from the
+/// GP inputs and targets.
+class GPModel : public virtual Model {
+ public:
+    virtual ~GPModel() = default;
+
+    /// Documentation inherited
+    /// Given an action vector from ObjectOrientedActionSpace and an SE2 state
+    /// vector, this function predicts end SE2 state vector.
+    bool predict_state(
+        const Eigen::VectorXd& input_action,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override;
+
+    /// Documentation inherited
+    bool predict_states(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states) const override;
+
+    /// Documentation inherited
+    /// The predictive variance of [distance, dtheta] is propagated to the end
+    /// state with a first-order (linearized) approximation
+    bool predict_distribution(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states,
+        Eigen::MatrixXd* output_variances) const override;
+
+    /// Converts ObjectOrientedActionSpace action vectors to GP inputs
+    ///
+    /// \param actions Action vectors, one per row
+    /// \return GP inputs [speed, edge_offset, aspect_ratio], one per row
+    static Eigen::MatrixXd get_inputs(const Eigen::MatrixXd& actions);
+
+    /// Converts observed start and end states to GP targets
+    ///
+    /// \param start_states SE2 state vectors before the action, one per row
+    /// \param end_states SE2 state vectors after the action, one per row
+    /// \return GP targets [distance, dtheta], one per row
+    static Eigen::MatrixXd get_targets(
+        const Eigen::MatrixXd& start_states,
+        const Eigen::MatrixXd& end_states);
+
+    /// Number of GP input dimensions
+    static constexpr int kInputSize = 3;
+
+    /// Number of GP output dimensions
+    static constexpr int kOutputSize = 2;
+
+ protected:
+    /// Runs inference on the given GP inputs
+    ///
+    /// \param inputs GP inputs, one per row
+    /// \param[out] means Predictive mean of [distance, dtheta], one per row
+    /// \param[out] variances Predictive variance of [distance, dtheta], one
+    /// per row; nullptr if the variance is not needed
+    /// \return True if inference successful; false otherwise
+    virtual bool predict_targets(
+        const Eigen::MatrixXd& inputs,
+        Eigen::MatrixXd* means,
+        Eigen::MatrixXd* variances) const = 0;
+
+ private:
+    /// Shared implementation of predict_states and predict_distribution
+    bool predict(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states,
+        Eigen::MatrixXd* output_variances) const;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_GPMODEL_HPP_
@@ -65,7 +65,48 @@ class GPRModel : public virtual Model {
         const Eigen::VectorXd& input_state,
         Eigen::VectorXd* output_state) const override;
 
+    /// Documentation inherited
+    /// Runs a single inference pass over all rows of the input
+    bool predict_states(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states) const override;
+
+    /// Documentation inherited
+    /// The predictive standard deviation of [distance, dtheta] is returned by
+    /// the same inference pass as the mean and is propagated to the end state
+    /// with a first-order (linearized) approximation
+    bool predict_distribution(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states,
+        Eigen::MatrixXd* output_variances) const override;
+
+    /// Documentation inherited
+    /// Inference runs in the embedded python interpreter, which must only be
+    /// used from one thread at a time
+    bool is_thread_safe() const override {
+        return false;
+    }
+
  private:
+    /// Builds the python model input (list of [speed, edge_offset,
+    /// aspect_ratio] lists) from the given action vectors
+    ///
+    /// \param input_actions Action vectors, one per row
+    /// \return New reference to the python list
+    PyObject* create_batch_input(const Eigen::MatrixXd& input_actions) const;
+
+    /// Calls the given function of the compiled python module on the model
+    /// and the batch input
+    ///
+    /// \param function_name Name of the inference function
+    /// \param input_actions Action vectors, one per row
+    /// \return New reference to the python result; NULL if inference failed
+    PyObject* run_batch_inference(
+        const char* function_name,
+        const Eigen::MatrixXd& input_actions) const;
+
     const std::shared_ptr<ModelFramework> m_framework;
 };
 
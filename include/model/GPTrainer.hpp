@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_GPTRAINER_HPP_
+#define INCLUDE_MODEL_GPTRAINER_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include <vector>
+#include "model/Dataset.hpp"
+#include "model/ModelFile.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// This class trains exact Gaussian Processes natively, i.e. without
+/// scikit-learn, and produces the parameters stored in the native model file
+/// format (see ModelFile and NativeGPRModel).
+///
+/// The hyperparameters (length scales, signal variance and noise variance)
+/// are shared by all outputs and chosen by maximizing the log marginal
+/// likelihood of the normalized targets with L-BFGS. The optimization is
+/// restarted from several initial hyperparameters in parallel and the best
+/// restart is kept. Hyperparameters are optimized in log space and bounded
+/// to [1e-5, 1e5].
+class GPTrainer {
+ public:
+    /// Training options
+    struct Parameters {
+        Parameters() :
+            kernel_type(KernelType::RBF),
+            isotropic(false),
+            num_restarts(8),
+            max_iterations(100),
+            gradient_tolerance(1e-5),
+            max_samples(1000),
+            seed(0) {}
+
+        /// Covariance function
+        KernelType kernel_type;
+        /// Whether all input dimensions share one length scale
+        bool isotropic;
+        /// Number of optimizations; the first one starts from the standard
+        /// deviation of the inputs as length scales, the others from random
+        /// hyperparameters
+        int num_restarts;
+        /// Maximum number of L-BFGS iterations per restart
+        int max_iterations;
+        /// Optimization stops once the gradient norm is below this value
+        double gradient_tolerance;
+        /// Training costs O(n^3); larger datasets are subsampled uniformly
+        /// at random
+        int max_samples;
+        /// Seed of the random number generator
+        unsigned int seed;
+    };
+
+    /// Summary of a training run
+    struct Result {
+        /// Log marginal likelihood of the kept hyperparameters
+        double log_marginal_likelihood;
+        /// Final log marginal likelihood of each restart; -inf if the
+        /// restart failed
+        std::vector<double> restart_log_marginal_likelihoods;
+        /// Index of the kept restart
+        int best_restart;
+        /// Number of samples the model was trained on
+        int num_samples;
+    };
+
+    /// Constructs the trainer
+    ///
+    /// Throws an invalid_argument exception if the parameters are invalid
+    ///
+    /// \param parameters Training options
+    /// \param num_threads Number of worker threads; if not positive, the
+    /// number of hardware threads is used
+    explicit GPTrainer(
+        const Parameters& parameters = Parameters(),
+        const int& num_threads = 0);
+
+    ~GPTrainer() = default;
+
+    /// Trains a GP on the given logged pushes; the GP maps the inputs of
+    /// GPModel::get_inputs to the targets of GPModel::get_targets
+    ///
+    /// \param dataset Logged pushes
+    /// \param[out] model Parameters of the trained GP
+    /// \param[out] result Summary of the training; may be NULL
+    /// \return True if trained successfully; false otherwise
+    bool train(
+        const Dataset& dataset,
+        GPParameters* model,
+        Result* result = nullptr) const;
+
+    /// Trains a GP on the given inputs and targets
+    ///
+    /// \param inputs GP inputs, one per row
+    /// \param targets GP targets, one per row
+    /// \param[out] model Parameters of the trained GP
+    /// \param[out] result Summary of the training; may be NULL
+    /// \return True if trained successfully; false otherwise
+    bool train(
+        const Eigen::MatrixXd& inputs,
+        const Eigen::MatrixXd& targets,
+        GPParameters* model,
+        Result* result = nullptr) const;
+
+    /// Calculates the log marginal likelihood of the targets and its
+    /// gradient with respect to the log hyperparameters
+    /// [log(length scales), log(signal variance), log(noise variance)]
+    ///
+    /// \param kernel_type Covariance function
+    /// \param inputs GP inputs, one per row
+    /// \param targets GP targets, one per row; each column is an independent
+    /// output with the same hyperparameters
+    /// \param log_hyperparameters Log of the hyperparameters
+    /// \param[out] value Log marginal likelihood
+    /// \param[out] gradient Gradient; may be NULL
+    /// \return True if calculated successfully; false otherwise (e.g. the
+    /// covariance matrix is not positive definite)
+    static bool log_marginal_likelihood(
+        const KernelType& kernel_type,
+        const Eigen::MatrixXd& inputs,
+        const Eigen::MatrixXd& targets,
+        const Eigen::VectorXd& log_hyperparameters,
+        double* value,
+        Eigen::VectorXd* gradient);
+
+ private:
+    /// Maximizes the log marginal likelihood from the given start
+    ///
+    /// \param inputs GP inputs, one per row
+    /// \param targets Normalized GP targets, one per row
+    /// \param[in, out] log_hyperparameters Start on input; optimum on output
+    /// \param[out] value Log marginal likelihood at the optimum
+    /// \return True if optimized successfully; false otherwise
+    bool optimize(
+        const Eigen::MatrixXd& inputs,
+        const Eigen::MatrixXd& targets,
+        Eigen::VectorXd* log_hyperparameters,
+        double* value) const;
+
+    const Parameters m_parameters;
+    const std::unique_ptr<utils::ThreadPool> m_pool;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_GPTRAINER_HPP_
@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_KERNEL_HPP_
+#define INCLUDE_MODEL_KERNEL_HPP_
+
+#include <Eigen/Dense>
+#include <vector>
+
+namespace libcozmo {
+namespace model {
+
+/// Abstract class for stationary covariance functions used by the natively
+/// evaluated Gaussian Process models.
+///
+/// The covariance between two inputs only depends on the squared distance r^2
+/// between the inputs after scaling each dimension by its length scale.
+class Kernel {
+ public:
+    /// Constructs kernel with the given hyperparameters
+    ///
+    /// Throws an invalid_argument exception if a length scale or the signal
+    /// variance is not positive
+    ///
+    /// \param length_scales Length scale of each input dimension; a single
+    /// length scale is shared by all dimensions (isotropic kernel)
+    /// \param signal_variance Variance of the process, k(x, x)
+    Kernel(
+        const Eigen::VectorXd& length_scales,
+        const double& signal_variance);
+
+    virtual ~Kernel() = default;
+
+    /// Calculates the covariance between two inputs
+    ///
+    /// \param input_1, input_2 Input vectors
+    /// \return Covariance
+    double evaluate(
+        const Eigen::VectorXd& input_1,
+        const Eigen::VectorXd& input_2) const;
+
+    /// Calculates the covariance matrix between two sets of inputs
+    ///
+    /// \param inputs_1 Input vectors, one per row
+    /// \param inputs_2 Input vectors, one per row
+    /// \param[out] covariance Covariance matrix (rows of inputs_1 x rows of
+    /// inputs_2)
+    void compute(
+        const Eigen::Ref<const Eigen::MatrixXd>& inputs_1,
+        const Eigen::Ref<const Eigen::MatrixXd>& inputs_2,
+        Eigen::MatrixXd* covariance) const;
+
+    /// Calculates the covariance matrix of a set of inputs and its
+    /// derivatives with respect to the log of each length scale
+    ///
+    /// \param inputs Input vectors, one per row
+    /// \param[out] covariance Covariance matrix (rows x rows)
+    /// \param[out] gradients Derivative of the covariance matrix with
+    /// respect to the log of each length scale
+    void compute_gradients(
+        const Eigen::Ref<const Eigen::MatrixXd>& inputs,
+        Eigen::MatrixXd* covariance,
+        std::vector<Eigen::MatrixXd>* gradients) const;
+
+    /// Gets the length scale of each input dimension
+    const Eigen::VectorXd& length_scales() const;
+
+    /// Gets the variance of the process, k(x, x)
+    double signal_variance() const;
+
+ protected:
+    /// Converts scaled squared distances to covariances in place
+    ///
+    /// \param[in, out] values Scaled squared distances r^2 on input;
+    /// covariances on output
+    virtual void profile(Eigen::ArrayXXd* values) const = 0;
+
+    /// Converts scaled squared distances to the derivative of the covariance
+    /// with respect to the scaled squared distance in place
+    ///
+    /// \param[in, out] values Scaled squared distances r^2 on input;
+    /// dk / dr^2 on output
+    virtual void profile_derivative(Eigen::ArrayXXd* values) const = 0;
+
+    /// Divides each input dimension by its length scale
+    ///
+    /// \param inputs Input vectors, one per row
+    /// \return Scaled input vectors, one per row
+    Eigen::MatrixXd scale(
+        const Eigen::Ref<const Eigen::MatrixXd>& inputs) const;
+
+    Eigen::VectorXd m_length_scales;
+    double m_signal_variance;
+};
+
+/// Radial basis function (squared exponential) kernel
+/// k(r) = signal_variance * exp(-r^2 / 2)
+class RBFKernel : public Kernel {
+ public:
+    /// Documentation inherited
+    RBFKernel(
+        const Eigen::VectorXd& length_scales,
+        const double& signal_variance) :
+        Kernel(length_scales, signal_variance) {}
+
+ protected:
+    /// Documentation inherited
+    void profile(Eigen::ArrayXXd* values) const override;
+
+    /// Documentation inherited
+    void profile_derivative(Eigen::ArrayXXd* values) const override;
+};
+
+/// Matern kernel with smoothness nu = 3/2 or nu = 5/2
+/// k(r) = signal_variance * (1 + sqrt(3) r) * exp(-sqrt(3) r) for nu = 3/2
+/// k(r) = signal_variance * (1 + sqrt(5) r + 5 r^2 / 3) * exp(-sqrt(5) r)
+/// for nu = 5/2
+class MaternKernel : public Kernel {
+ public:
+    /// Constructs kernel with the given hyperparameters
+    ///
+    /// Throws an invalid_argument exception if nu is not 1.5 or 2.5
+    ///
+    /// \param length_scales Length scale of each input dimension
+    /// \param signal_variance Variance of the process, k(x, x)
+    /// \param nu Smoothness of the kernel; either 1.5 or 2.5
+    MaternKernel(
+        const Eigen::VectorXd& length_scales,
+        const double& signal_variance,
+        const double& nu);
+
+    /// Gets the smoothness of the kernel
+    double nu() const;
+
+ protected:
+    /// Documentation inherited
+    void profile(Eigen::ArrayXXd* values) const override;
+
+    /// Documentation inherited
+    void profile_derivative(Eigen::ArrayXXd* values) const override;
+
+ private:
+    const double m_nu;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_KERNEL_HPP_
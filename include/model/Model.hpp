@@ -51,6 +51,69 @@ class Model {
         const Eigen::VectorXd& input_action,
         const Eigen::VectorXd& input_state,
         Eigen::VectorXd* output_state) const = 0;
+
+    /// Gets the end states after applying each action on the corresponding
+    /// state. Each row of the input matrices is one (action, state) sample.
+    /// Derived classes that can evaluate a batch in one call (i.e. one
+    /// inference pass) should override this function
+    ///
+    /// \param input_actions Given action vectors, one per row
+    /// \param input_states Given state vectors, one per row
+    /// \param[out] output_states End state vectors, one per row
+    /// \return True if all predictions successfully calculated; false
+    /// otherwise
+    virtual bool predict_states(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states) const {
+        if (input_actions.rows() != input_states.rows()) {
+            return false;
+        }
+        output_states->resize(input_states.rows(), input_states.cols());
+        Eigen::VectorXd output_state;
+        for (int i = 0; i < input_actions.rows(); ++i) {
+            if (!predict_state(
+                    input_actions.row(i).transpose(),
+                    input_states.row(i).transpose(),
+                    &output_state)) {
+                return false;
+            }
+            output_states->row(i) = output_state.transpose();
+        }
+        return true;
+    }
+
+    /// Gets the predictive mean and variance of the end states after applying
+    /// each action on the corresponding state. Both are computed by the same
+    /// inference pass. Deterministic models report zero variance
+    ///
+    /// \param input_actions Given action vectors, one per row
+    /// \param input_states Given state vectors, one per row
+    /// \param[out] output_states Mean end state vectors, one per row
+    /// \param[out] output_variances Variance of each element of the end state
+    /// vectors (i.e. diagonal of the covariance), one per row
+    /// \return True if all predictions successfully calculated; false
+    /// otherwise
+    virtual bool predict_distribution(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states,
+        Eigen::MatrixXd* output_variances) const {
+        if (!predict_states(input_actions, input_states, output_states)) {
+            return false;
+        }
+        output_variances->setZero(
+            output_states->rows(), output_states->cols());
+        return true;
+    }
+
+    /// Whether the const prediction functions of this model can be called
+    /// concurrently from multiple threads
+    ///
+    /// \return True if concurrent predictions are safe; false otherwise
+    virtual bool is_thread_safe() const {
+        return true;
+    }
 };
 
 }  // namespace model
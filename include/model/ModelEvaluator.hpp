@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_MODELEVALUATOR_HPP_
+#define INCLUDE_MODEL_MODELEVALUATOR_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include <string>
+#include <vector>
+#include "model/Dataset.hpp"
+#include "model/Model.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// This class measures how well models predict logged pushes.
+///
+/// For every sample the predicted end state is compared with the observed end
+/// state; the position error is the euclidean distance between the [x, y]
+/// positions and the heading error is the absolute shortest angle between
+/// the orientations. Models are evaluated one after another so that each
+/// model's throughput is measured on its own; the batches of a thread safe
+/// model are split across a thread pool.
+class ModelEvaluator {
+ public:
+    /// Summary of an error distribution
+    struct ErrorStatistics {
+        double mean;
+        double rmse;
+        double median;
+        double percentile_90;
+        double percentile_99;
+        double max;
+    };
+
+    /// Evaluation results of one model
+    struct Report {
+        std::string name;
+        /// Number of evaluated samples
+        int num_samples;
+        /// Number of samples the model failed to predict
+        int num_failures;
+        ErrorStatistics position_error;
+        ErrorStatistics heading_error;
+        /// Time spent in the model (seconds)
+        double seconds;
+        /// Evaluated samples per second
+        double samples_per_second;
+    };
+
+    /// Constructs the evaluator given the models to compare
+    ///
+    /// \param models The models to evaluate
+    /// \param names Name of each model used in the reports
+    /// \param num_threads Number of worker threads; if not positive, the
+    /// number of hardware threads is used
+    ModelEvaluator(
+        const std::vector<std::shared_ptr<Model>>& models,
+        const std::vector<std::string>& names,
+        const int& num_threads = 0);
+
+    ~ModelEvaluator() = default;
+
+    /// Evaluates all models on the given samples and accumulates the errors
+    ///
+    /// \param dataset The samples
+    void evaluate(const Dataset& dataset);
+
+    /// Streams the given dataset file and evaluates all models on it; the
+    /// next chunk is read while the current one is evaluated
+    ///
+    /// Throws an invalid_argument exception if the file can't be read
+    ///
+    /// \param dataset_path The path to the dataset file
+    /// \param chunk_size Number of samples per chunk
+    /// \return Number of samples read
+    int evaluate_file(
+        const std::string& dataset_path,
+        const int& chunk_size = 65536);
+
+    /// Gets the evaluation results of each model, in model order
+    std::vector<Report> get_reports() const;
+
+    /// Discards the accumulated errors
+    void reset();
+
+    /// Computes the position and heading error of each prediction
+    ///
+    /// \param predicted_states Predicted end state vectors, one per row
+    /// \param observed_states Observed end state vectors, one per row
+    /// \param[out] position_errors Position error of each row
+    /// \param[out] heading_errors Heading error of each row
+    static void compute_errors(
+        const Eigen::MatrixXd& predicted_states,
+        const Eigen::MatrixXd& observed_states,
+        Eigen::VectorXd* position_errors,
+        Eigen::VectorXd* heading_errors);
+
+    /// Summarizes the given errors; all fields are zero if there are none
+    ///
+    /// \param errors The errors, reordered by this function
+    static ErrorStatistics summarize(std::vector<double>* errors);
+
+ private:
+    /// Accumulated results of one model
+    struct Accumulator {
+        Accumulator() : num_failures(0), seconds(0.0) {}
+
+        std::vector<double> position_errors;
+        std::vector<double> heading_errors;
+        int num_failures;
+        double seconds;
+    };
+
+    /// Evaluates the model on the rows [begin, end) of the dataset
+    ///
+    /// \param model The model
+    /// \param dataset The samples
+    /// \param begin, end Range of rows
+    /// \param[out] position_errors Position errors of rows [begin, end)
+    /// \param[out] heading_errors Heading errors of rows [begin, end)
+    /// \return True if the model predicted the rows; false otherwise
+    static bool evaluate_rows(
+        const Model& model,
+        const Dataset& dataset,
+        const int& begin,
+        const int& end,
+        Eigen::VectorXd* position_errors,
+        Eigen::VectorXd* heading_errors);
+
+    const std::vector<std::shared_ptr<Model>> m_models;
+    const std::vector<std::string> m_names;
+    std::vector<Accumulator> m_accumulators;
+    const std::unique_ptr<utils::ThreadPool> m_pool;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_MODELEVALUATOR_HPP_
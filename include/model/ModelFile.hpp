@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_MODELFILE_HPP_
+#define INCLUDE_MODEL_MODELFILE_HPP_
+
+#include <Eigen/Dense>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "model/Kernel.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// Covariance functions that can be stored in a model file
+enum class KernelType : uint32_t {
+    RBF = 0,
+    MATERN_3_2 = 1,
+    MATERN_5_2 = 2
+};
+
+/// Parameters of a trained exact Gaussian Process
+///
+/// The predictive mean of output j for input x is
+/// target_mean[j] + target_scale[j] * k(x, inputs) * weights.col(j)
+/// and its variance is
+/// target_scale[j]^2 * (k(x, x) - |cholesky^-1 k(inputs, x)|^2)
+struct GPParameters {
+    KernelType kernel_type;
+
+    /// Length scale of each input dimension or a single shared length scale
+    Eigen::VectorXd length_scales;
+    double signal_variance;
+    double noise_variance;
+
+    /// Training inputs, one per row (n x input size)
+    Eigen::MatrixXd inputs;
+
+    /// (K + noise * I)^-1 y for the normalized training targets
+    /// (n x output size)
+    Eigen::MatrixXd weights;
+
+    /// Lower triangular Cholesky factor of K + noise * I (n x n); may be empty
+    /// in which case only the predictive mean is available
+    Eigen::MatrixXd cholesky;
+
+    /// Normalization of the training targets (output size)
+    Eigen::VectorXd target_mean;
+    Eigen::VectorXd target_scale;
+};
+
+/// This class reads and writes the native model file format, a versioned
+/// binary format for trained exact Gaussian Processes.
+///
+/// A model file is a ModelFile::Header followed by the arrays of GPParameters
+/// stored as doubles in the following order: length_scales,
+/// target_mean, target_scale, inputs, weights and, if present, cholesky.
+/// Matrices are stored in column major order. All values are in the native
+/// byte order of the machine that wrote the file, which is recorded in the
+/// header; files of the other byte order are rejected.
+///
+/// Files are memory mapped so loading a model does not copy the arrays; they
+/// are accessed in place through Eigen maps.
+class ModelFile {
+ public:
+    /// Fixed size header at the start of the file
+    struct Header {
+        /// Always "COZMOGP" followed by a null character
+        char magic[8];
+        uint32_t version;
+        uint32_t kernel_type;
+        uint32_t num_samples;
+        uint32_t input_size;
+        uint32_t output_size;
+        uint32_t num_length_scales;
+        uint32_t has_cholesky;
+        /// Always kByteOrderMark in the byte order of the writer
+        uint32_t byte_order;
+        double signal_variance;
+        double noise_variance;
+    };
+
+    /// Current version of the format
+    static constexpr uint32_t kVersion = 2;
+
+    /// Reads back unchanged only if the file has the native byte order
+    static constexpr uint32_t kByteOrderMark = 0x01020304;
+
+    using ConstMatrixMap = Eigen::Map<const Eigen::MatrixXd>;
+    using ConstVectorMap = Eigen::Map<const Eigen::VectorXd>;
+
+    /// Memory maps the given model file
+    ///
+    /// Throws an invalid_argument exception if the file can't be mapped or
+    /// is not a valid model file of the current version and native byte
+    /// order, or if it has neither one nor input size length scales
+    ///
+    /// \param model_path The path to the model file
+    explicit ModelFile(const std::string& model_path);
+
+    /// Unmaps the file
+    ~ModelFile();
+
+    ModelFile(const ModelFile&) = delete;
+    ModelFile& operator=(const ModelFile&) = delete;
+
+    /// Writes the given parameters to a model file
+    ///
+    /// \param model_path The path to the model file
+    /// \param parameters Parameters of the trained GP
+    /// \return True if written successfully; false otherwise
+    static bool write(
+        const std::string& model_path,
+        const GPParameters& parameters);
+
+    /// Creates the covariance function with the given hyperparameters
+    ///
+    /// Throws an invalid_argument exception if the hyperparameters are
+    /// invalid
+    ///
+    /// \param kernel_type Type of covariance function
+    /// \param length_scales Length scale of each input dimension
+    /// \param signal_variance Variance of the process
+    /// \return The covariance function
+    static std::shared_ptr<Kernel> create_kernel(
+        const KernelType& kernel_type,
+        const Eigen::VectorXd& length_scales,
+        const double& signal_variance);
+
+    /// Gets the file header
+    const Header& header() const;
+
+    /// Creates the covariance function stored in the file
+    std::shared_ptr<Kernel> kernel() const;
+
+    /// Gets the training inputs (n x input size)
+    ConstMatrixMap inputs() const;
+
+    /// Gets the weights of the predictive mean (n x output size)
+    ConstMatrixMap weights() const;
+
+    /// Gets the Cholesky factor (n x n); empty if not stored
+    ConstMatrixMap cholesky() const;
+
+    /// Gets the normalization of the training targets (output size)
+    ConstVectorMap target_mean() const;
+    ConstVectorMap target_scale() const;
+
+    /// Gets the length scales
+    ConstVectorMap length_scales() const;
+
+ private:
+    /// Gets the start of the array at the given offset (in doubles) after the
+    /// header
+    const double* data(const size_t& offset) const;
+
+    void* m_address;
+    size_t m_size;
+
+    /// Offsets (in doubles) of the arrays after the header
+    size_t m_target_mean_offset;
+    size_t m_target_scale_offset;
+    size_t m_inputs_offset;
+    size_t m_weights_offset;
+    size_t m_cholesky_offset;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_MODELFILE_HPP_
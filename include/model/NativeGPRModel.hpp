@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_NATIVEGPRMODEL_HPP_
+#define INCLUDE_MODEL_NATIVEGPRMODEL_HPP_
+
+#include <memory>
+#include <string>
+#include "model/GPModel.hpp"
+#include "model/Kernel.hpp"
+#include "model/ModelFile.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// This class implements an exact Gaussian Process Regressor loaded from the
+/// native model file format (see ModelFile).
+///
+/// The model file is memory mapped and its arrays are used in place, so
+/// loading a model is independent of its size and does not need the python
+/// interpreter. Model files are created from scikit-learn models with the
+/// convert_sklearn_model tool or by GPTrainer.
+class NativeGPRModel : public virtual GPModel {
+ public:
+    /// Loads model from the given model file
+    ///
+    /// Throws an invalid_argument exception if the file is not a valid model
+    /// file or the model does not have the GPModel inputs and outputs
+    ///
+    /// \param model_path The path to the model file
+    explicit NativeGPRModel(const std::string& model_path);
+
+    ~NativeGPRModel() = default;
+
+    /// Gets the memory mapped model file
+    const ModelFile& model_file() const;
+
+ protected:
+    /// Documentation inherited
+    /// The variance is only available if the model file stores the Cholesky
+    /// factor
+    bool predict_targets(
+        const Eigen::MatrixXd& inputs,
+        Eigen::MatrixXd* means,
+        Eigen::MatrixXd* variances) const override;
+
+ private:
+    const std::unique_ptr<ModelFile> m_file;
+    const std::shared_ptr<Kernel> m_kernel;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_NATIVEGPRMODEL_HPP_
@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_ONLINEGPRMODEL_HPP_
+#define INCLUDE_MODEL_ONLINEGPRMODEL_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include "model/Dataset.hpp"
+#include "model/GPModel.hpp"
+#include "model/Kernel.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// This class implements an exact Gaussian Process Regressor that is updated
+/// online with newly observed pushes.
+///
+/// The model keeps a sliding window of the most recent samples. The Cholesky
+/// factor of the covariance matrix is extended when a sample is added and
+/// updated with a rank-one update when the oldest sample is dropped, so
+/// adding a sample costs O(n^2) instead of the O(n^3) of a refit.
+///
+/// Adding samples while another thread is running inference is not safe.
+class OnlineGPRModel : public virtual GPModel {
+ public:
+    /// Constructs model without any samples
+    ///
+    /// Throws an invalid_argument exception if the kernel is a nullptr, the
+    /// noise variance is negative or the window size is not positive
+    ///
+    /// \param kernel Covariance function
+    /// \param noise_variance Variance of the observation noise
+    /// \param max_samples Size of the window (maximum number of samples)
+    OnlineGPRModel(
+        const std::shared_ptr<Kernel> kernel,
+        const double& noise_variance,
+        const int& max_samples);
+
+    ~OnlineGPRModel() = default;
+
+    /// Adds an observed push to the model; if the window is full the oldest
+    /// sample is dropped. A rejected sample leaves the model unchanged
+    ///
+    /// \param action Executed ObjectOrientedActionSpace action vector
+    /// \param start_state SE2 state vector before the action
+    /// \param end_state Observed SE2 state vector after the action
+    /// \return True if the sample was added; false otherwise
+    bool add_sample(
+        const Eigen::VectorXd& action,
+        const Eigen::VectorXd& start_state,
+        const Eigen::VectorXd& end_state);
+
+    /// Adds all samples of the given dataset in order
+    ///
+    /// \param dataset Logged pushes
+    /// \return True if all samples were added; false otherwise
+    bool add_samples(const Dataset& dataset);
+
+    /// Removes all samples
+    void clear();
+
+    /// Gets the number of samples in the window
+    int size() const;
+
+    /// Gets the size of the window
+    int max_samples() const;
+
+ protected:
+    /// Documentation inherited
+    bool predict_targets(
+        const Eigen::MatrixXd& inputs,
+        Eigen::MatrixXd* means,
+        Eigen::MatrixXd* variances) const override;
+
+ private:
+    /// Adds a sample given its GP input and target
+    bool add_sample(
+        const Eigen::VectorXd& input,
+        const Eigen::VectorXd& target);
+
+    /// Calculates the new diagonal entry d^2 of the Cholesky factor if the
+    /// oldest sample was removed and the input added, without modifying the
+    /// model
+    ///
+    /// \param input GP input of the new sample
+    /// \return d^2; the sample can only be added if it is positive
+    double remaining_variance(const Eigen::VectorXd& input) const;
+
+    /// Removes the oldest sample and updates the Cholesky factor
+    void remove_oldest_sample();
+
+    /// Recomputes the weights of the predictive mean from the Cholesky factor
+    void update_weights();
+
+    const std::shared_ptr<Kernel> m_kernel;
+    const double m_noise_variance;
+    const int m_max_samples;
+
+    /// Number of samples in the window
+    int m_size;
+
+    /// GP inputs and targets of the samples, oldest first; only the first
+    /// m_size rows are valid
+    Eigen::MatrixXd m_inputs;
+    Eigen::MatrixXd m_targets;
+
+    /// Lower triangular Cholesky factor of K + noise * I; only the top left
+    /// m_size x m_size block is valid
+    Eigen::MatrixXd m_cholesky;
+
+    /// (K + noise * I)^-1 y for the samples in the window
+    Eigen::MatrixXd m_weights;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_ONLINEGPRMODEL_HPP_
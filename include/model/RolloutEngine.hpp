@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_ROLLOUTENGINE_HPP_
+#define INCLUDE_MODEL_ROLLOUTENGINE_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include "actionspace/ActionSpace.hpp"
+#include "model/Model.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// States visited by K action sequences of length H, stored as one contiguous
+/// K x (H + 1) x D tensor where D is the size of a state vector.
+///
+/// The tensor is a column major K x ((H + 1) * D) matrix; element (k, t, d)
+/// is data(k, t * D + d). The states of all sequences at one timestep are
+/// therefore a contiguous K x D block, i.e. exactly the batch layout used by
+/// Model::predict_states. Timestep 0 holds the start states.
+struct Rollouts {
+    Rollouts() : num_sequences(0), horizon(0), state_size(0) {}
+
+    /// Gets the states of all sequences at the given timestep, one per row
+    ///
+    /// \param timestep Timestep in [0, horizon]
+    Eigen::MatrixXd::ColsBlockXpr timestep(const int& timestep) {
+        return data.middleCols(timestep * state_size, state_size);
+    }
+
+    /// Gets the states of all sequences at the given timestep, one per row
+    ///
+    /// \param timestep Timestep in [0, horizon]
+    Eigen::MatrixXd::ConstColsBlockXpr timestep(const int& timestep) const {
+        return data.middleCols(timestep * state_size, state_size);
+    }
+
+    /// Gets the state of one sequence at the given timestep
+    ///
+    /// \param sequence Sequence in [0, num_sequences)
+    /// \param timestep Timestep in [0, horizon]
+    Eigen::VectorXd state(const int& sequence, const int& timestep) const {
+        return data.block(
+            sequence, timestep * state_size, 1, state_size).transpose();
+    }
+
+    int num_sequences;
+    int horizon;
+    int state_size;
+    Eigen::MatrixXd data;
+};
+
+/// This class pushes many action sequences through a model, e.g. to score
+/// candidate plans for model predictive control or lookahead heuristics.
+///
+/// The sequences are split into chunks that run concurrently on a thread
+/// pool; within a chunk the model is called once per timestep with the batch
+/// of all sequences of the chunk. Models that are not thread safe run the
+/// whole batch on the calling thread.
+class RolloutEngine {
+ public:
+    /// Constructs the engine given the model and the action space the action
+    /// ids refer to. The action vectors are cached on construction so the
+    /// action space does not need to outlive the engine
+    ///
+    /// \param model The model that predicts the next state
+    /// \param actionspace The action space of the action ids
+    /// \param num_threads Number of worker threads; if not positive, the
+    /// number of hardware threads is used
+    RolloutEngine(
+        const std::shared_ptr<Model> model,
+        const actionspace::ActionSpace& actionspace,
+        const int& num_threads = 0);
+
+    ~RolloutEngine() = default;
+
+    /// Rolls out all action sequences from the same start state
+    ///
+    /// \param start_state The start state vector
+    /// \param action_ids K x H matrix, row k is the k-th action sequence
+    /// \param[out] rollouts The visited states
+    /// \return True if all predictions successfully calculated; false
+    /// otherwise (e.g. invalid action id)
+    bool rollout(
+        const Eigen::VectorXd& start_state,
+        const Eigen::MatrixXi& action_ids,
+        Rollouts* rollouts) const;
+
+    /// Rolls out each action sequence from its own start state
+    ///
+    /// \param start_states K x D matrix, row k is the start of sequence k
+    /// \param action_ids K x H matrix, row k is the k-th action sequence
+    /// \param[out] rollouts The visited states
+    /// \return True if all predictions successfully calculated; false
+    /// otherwise (e.g. invalid action id)
+    bool rollout_from_states(
+        const Eigen::MatrixXd& start_states,
+        const Eigen::MatrixXi& action_ids,
+        Rollouts* rollouts) const;
+
+    /// Gets the cached action vectors, row i is the vector of action id i
+    const Eigen::MatrixXd& action_vectors() const;
+
+ private:
+    /// Rolls out the sequences [begin, end) one timestep at a time; the
+    /// start states of these sequences must already be in the rollouts
+    ///
+    /// \param action_ids K x H matrix of all action sequences
+    /// \param begin, end Range of sequences to roll out
+    /// \param[out] rollouts The visited states
+    /// \return True if all predictions successfully calculated; false
+    /// otherwise
+    bool rollout_chunk(
+        const Eigen::MatrixXi& action_ids,
+        const int& begin,
+        const int& end,
+        Rollouts* rollouts) const;
+
+    const std::shared_ptr<Model> m_model;
+    Eigen::MatrixXd m_action_vectors;
+    const std::unique_ptr<utils::ThreadPool> m_pool;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_ROLLOUTENGINE_HPP_
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_SPARSEGPRMODEL_HPP_
+#define INCLUDE_MODEL_SPARSEGPRMODEL_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include "model/Dataset.hpp"
+#include "model/GPModel.hpp"
+#include "model/Kernel.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// This class implements a sparse Gaussian Process Regressor using the Fully
+/// Independent Training Conditional (FITC) approximation.
+///
+/// The n training samples are summarized by m << n inducing points so
+/// training costs O(n m^2) and predicting the mean of a sample costs O(m)
+/// (O(m^2) with the variance) instead of O(n) (O(n^2)) for the exact GP.
+class SparseGPRModel : public virtual GPModel {
+ public:
+    /// Constructs untrained model with the given hyperparameters
+    ///
+    /// Throws an invalid_argument exception if the kernel is a nullptr or the
+    /// noise variance is negative
+    ///
+    /// \param kernel Covariance function
+    /// \param noise_variance Variance of the observation noise
+    SparseGPRModel(
+        const std::shared_ptr<Kernel> kernel,
+        const double& noise_variance);
+
+    ~SparseGPRModel() = default;
+
+    /// Trains the model on the given dataset with inducing points drawn
+    /// uniformly at random (without replacement) from the training inputs
+    ///
+    /// \param dataset Logged pushes
+    /// \param num_inducing_points Number of inducing points (m)
+    /// \param seed Seed of the random number generator
+    /// \return True if trained successfully; false otherwise
+    bool train(
+        const Dataset& dataset,
+        const int& num_inducing_points,
+        const unsigned int& seed = 0);
+
+    /// Trains the model on the given GP inputs and targets
+    ///
+    /// \param inputs GP inputs, one per row
+    /// \param targets GP targets, one per row
+    /// \param inducing_points Inducing inputs, one per row
+    /// \return True if trained successfully; false otherwise
+    bool train(
+        const Eigen::MatrixXd& inputs,
+        const Eigen::MatrixXd& targets,
+        const Eigen::MatrixXd& inducing_points);
+
+    /// Checks whether the model has been trained
+    bool is_trained() const;
+
+    /// Gets the inducing points, one per row
+    const Eigen::MatrixXd& inducing_points() const;
+
+ protected:
+    /// Documentation inherited
+    bool predict_targets(
+        const Eigen::MatrixXd& inputs,
+        Eigen::MatrixXd* means,
+        Eigen::MatrixXd* variances) const override;
+
+ private:
+    const std::shared_ptr<Kernel> m_kernel;
+    const double m_noise_variance;
+
+    /// Inducing inputs (m x input size)
+    Eigen::MatrixXd m_inducing_points;
+
+    /// Weights of the inducing point covariances for the predictive mean
+    /// (m x output size)
+    Eigen::MatrixXd m_weights;
+
+    /// Kmm^-1 - Σ, where Σ is the posterior covariance of the inducing
+    /// outputs, for the predictive variance (m x m)
+    Eigen::MatrixXd m_variance_weights;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_SPARSEGPRMODEL_HPP_
@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_MODEL_UNICYCLEMODEL_HPP_
+#define INCLUDE_MODEL_UNICYCLEMODEL_HPP_
+
+#include <Eigen/Dense>
+#include "model/Model.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// This class implements a closed-form kinematic model of a differential
+/// drive (unicycle) robot.
+///
+/// Given a GenericActionSpace action [speed, duration, heading] and an SE2
+/// state [x, y, theta], the robot turns in place to theta + heading and then
+/// drives straight at the given speed for the given duration:
+/// theta' = theta + heading
+/// x' = x + speed * duration * cos(theta')
+/// y' = y + speed * duration * sin(theta')
+/// The end orientation is normalized to [0, 2pi).
+///
+/// The model is cheap enough for heuristic rollouts and lattice generation
+/// and is a natural first stage before evaluating a learned model.
+class UnicycleModel : public virtual Model {
+ public:
+    UnicycleModel() = default;
+
+    ~UnicycleModel() = default;
+
+    /// Documentation inherited
+    /// Given an action vector from GenericActionSpace and an SE2 state
+    /// vector, this function predicts end SE2 state vector.
+    bool predict_state(
+        const Eigen::VectorXd& input_action,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override;
+
+    /// Documentation inherited
+    /// All rows are evaluated with vectorized array operations
+    bool predict_states(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states) const override;
+};
+
+}  // namespace model
+}  // namespace libcozmo
+
+#endif  // INCLUDE_MODEL_UNICYCLEMODEL_HPP_
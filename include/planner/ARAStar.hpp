@@ -0,0 +1,226 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_PLANNER_ARASTAR_HPP_
+#define INCLUDE_PLANNER_ARASTAR_HPP_
+
+#include <chrono>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "actionspace/ActionSpace.hpp"
+#include "distance/distance.hpp"
+#include "model/Model.hpp"
+#include "planner/DaryHeap.hpp"
+#include "planner/SE2Successors.hpp"
+#include "planner/SearchTable.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+
+/// This class implements Anytime Repairing A* (ARA*) over a discrete SE2
+/// statespace (Likhachev, Gordon and Thrun, 2003)
+///
+/// A first solution is found with a heuristic inflated by a large epsilon,
+/// then epsilon is decreased and the solution improved until epsilon
+/// reaches its final value or the time budget runs out. Each improvement
+/// reuses the g-values, the OPEN list and the INCONS list (states whose
+/// g-value decreased after they were expanded) of the previous search,
+/// so only the inconsistent part of the search tree is repaired.
+///
+/// Edge costs and the heuristic are both measured with the given metric,
+/// as for WeightedAStar.
+class ARAStar {
+ public:
+    /// Tuning parameters of the planner
+    struct Parameters {
+        Parameters() :
+            initial_epsilon(3.0),
+            final_epsilon(1.0),
+            epsilon_step(0.5),
+            goal_tolerance(0.0) {}
+
+        /// Heuristic inflation of the first search
+        double initial_epsilon;
+        /// Heuristic inflation at which the improvement stops, at least 1
+        double final_epsilon;
+        /// Decrease of epsilon between searches
+        double epsilon_step;
+        /// A state is a goal if its distance to the goal state is at most
+        /// this tolerance
+        double goal_tolerance;
+    };
+
+    /// Search statistics since the last call to solve()
+    struct Statistics {
+        Statistics() :
+            num_expansions(0),
+            num_searches(0),
+            epsilon(0),
+            suboptimality_bound(0),
+            path_cost(0),
+            seconds(0) {}
+
+        /// Number of expanded states over all searches
+        int num_expansions;
+        /// Number of completed searches, one per epsilon
+        int num_searches;
+        /// Epsilon of the last completed search
+        double epsilon;
+        /// Bound on the ratio between the cost of the returned path and
+        /// the optimal cost; infinite if no search completed
+        double suboptimality_bound;
+        /// Cost of the returned path
+        double path_cost;
+        /// Cost of the path after each completed search
+        std::vector<double> solution_costs;
+        /// Wall clock time spent planning (seconds)
+        double seconds;
+    };
+
+    /// Constructs the planner
+    ///
+    /// \param statespace The statespace states are registered in
+    /// \param actionspace The actions applied to every state
+    /// \param model The model that predicts the next state
+    /// \param distance Metric of the edge costs and the heuristic
+    /// \param parameters Tuning parameters
+    ARAStar(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<actionspace::ActionSpace> actionspace,
+        const std::shared_ptr<model::Model> model,
+        const std::shared_ptr<distance::Distance> distance,
+        const Parameters& parameters = Parameters());
+
+    ~ARAStar() = default;
+
+    /// Starts a new search from the start state to the goal state and
+    /// improves the solution until the time budget runs out
+    ///
+    /// \param start The start state
+    /// \param goal The goal state
+    /// \param time_budget Wall clock budget (seconds); if not positive, the
+    /// solution is improved until the final epsilon
+    /// \param[out] actions Action ids of the best path
+    /// \param[out] states State ids of the best path, start and reached
+    /// goal included; optional
+    /// \return True if a path was found; false otherwise
+    bool solve(
+        const statespace::SE2::State& start,
+        const statespace::SE2::State& goal,
+        const double& time_budget,
+        std::vector<int>* actions,
+        std::vector<int>* states = nullptr);
+
+    /// Continues improving the solution of the last solve()
+    ///
+    /// \param time_budget Wall clock budget (seconds); if not positive, the
+    /// solution is improved until the final epsilon
+    /// \param[out] actions Action ids of the best path
+    /// \param[out] states State ids of the best path; optional
+    /// \return True if a path was found; false otherwise
+    bool improve(
+        const double& time_budget,
+        std::vector<int>* actions,
+        std::vector<int>* states = nullptr);
+
+    /// Whether the last solution was found with the final epsilon
+    bool is_finished() const;
+
+    /// Gets the statistics since the last call to solve()
+    const Statistics& get_statistics() const;
+
+ private:
+    typedef std::chrono::steady_clock Clock;
+
+    /// Priority in the OPEN list, (f, h)
+    typedef std::pair<double, double> Key;
+
+    /// Runs searches with decreasing epsilon until the deadline
+    ///
+    /// \return True if a path was found; false otherwise
+    bool run(
+        const Clock::time_point& start_time,
+        const double& time_budget,
+        std::vector<int>* actions,
+        std::vector<int>* states);
+
+    /// Expands states until the goal cannot be improved with the current
+    /// epsilon or the deadline passes
+    ///
+    /// \return True if the search completed; false on the deadline
+    bool improve_path(const bool& has_deadline, const Clock::time_point& end);
+
+    /// Moves the INCONS states to OPEN, recomputes the priorities with the
+    /// current epsilon and forgets the expanded states
+    void prepare_search();
+
+    /// Computes the bound of the current solution after a completed search
+    double suboptimality_bound() const;
+
+    /// Gets the priority of a state for the current epsilon
+    Key key(const int& state_id);
+
+    /// Gets the heuristic of a state, computing it once
+    double heuristic(const int& state_id);
+
+    /// Whether a state is in the INCONS list
+    bool is_incons(const int& state_id) const;
+
+    const SE2Successors m_successors;
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<distance::Distance> m_distance;
+    const Parameters m_parameters;
+
+    statespace::SE2::State m_goal;
+    /// Start state of the query; -1 before the first solve
+    int m_start_id;
+    /// Best reached goal state; -1 if none
+    int m_goal_id;
+    double m_epsilon;
+    /// Whether the search with the current epsilon completed
+    bool m_search_completed;
+    /// Suboptimality bound after the last completed search, and the path
+    /// cost it was computed for
+    double m_bound;
+    double m_bound_cost;
+
+    SearchTable m_table;
+    DaryHeap<Key> m_open;
+    std::vector<int> m_incons;
+    /// Whether each state is in the INCONS list
+    std::vector<bool> m_in_incons;
+    Statistics m_statistics;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_ARASTAR_HPP_
@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_PLANNER_DARYHEAP_HPP_
+#define INCLUDE_PLANNER_DARYHEAP_HPP_
+
+#include <cassert>
+#include <vector>
+
+namespace libcozmo {
+namespace planner {
+
+/// Indexed d-ary min heap over non-negative integer ids (e.g. state ids)
+///
+/// Every id is in the heap at most once. The position of each id is kept
+/// in a table indexed by id, so membership tests, key updates and removals
+/// of arbitrary ids are O(1) lookups followed by a sift. A larger arity
+/// gives a shallower heap, which favors the frequent key decreases of
+/// graph searches over pops.
+///
+/// \tparam Key Priority type, ordered by operator<
+/// \tparam Arity Number of children per node
+template <typename Key, int Arity = 4>
+class DaryHeap {
+ public:
+    static_assert(Arity >= 2, "[DaryHeap] arity must be at least 2");
+
+    /// Whether the heap is empty
+    bool empty() const { return m_heap.empty(); }
+
+    /// Number of ids in the heap
+    int size() const { return m_heap.size(); }
+
+    /// Whether an id is in the heap
+    bool contains(const int& id) const {
+        return id >= 0 && id < static_cast<int>(m_positions.size()) &&
+            m_positions[id] >= 0;
+    }
+
+    /// Inserts an id, or changes its key if it is already in the heap
+    ///
+    /// \param id The id
+    /// \param key Priority of the id
+    void push(const int& id, const Key& key) {
+        assert(id >= 0);
+        if (id >= static_cast<int>(m_positions.size())) {
+            m_positions.resize(id + 1, -1);
+        }
+        int position = m_positions[id];
+        if (position < 0) {
+            position = m_heap.size();
+            m_heap.push_back(Entry{key, id});
+            m_positions[id] = position;
+            sift_up(position);
+        } else if (key < m_heap[position].key) {
+            m_heap[position].key = key;
+            sift_up(position);
+        } else {
+            m_heap[position].key = key;
+            sift_down(position);
+        }
+    }
+
+    /// Gets the id with the smallest key; the heap must not be empty
+    int top() const { return m_heap.front().id; }
+
+    /// Gets the smallest key; the heap must not be empty
+    const Key& top_key() const { return m_heap.front().key; }
+
+    /// Gets the key of an id in the heap
+    const Key& key(const int& id) const { return m_heap[m_positions[id]].key; }
+
+    /// Removes the id with the smallest key; the heap must not be empty
+    ///
+    /// \return The removed id
+    int pop() {
+        const int id = m_heap.front().id;
+        remove_at(0);
+        return id;
+    }
+
+    /// Removes an id if it is in the heap
+    void erase(const int& id) {
+        if (contains(id)) {
+            remove_at(m_positions[id]);
+        }
+    }
+
+    /// Calls a function with each id and its key, in heap order
+    ///
+    /// \param function Function taking (id, key)
+    template <typename Function>
+    void for_each(Function function) const {
+        for (const Entry& entry : m_heap) {
+            function(entry.id, entry.key);
+        }
+    }
+
+    /// Recomputes the key of every id and restores the heap property in
+    /// linear time
+    ///
+    /// \param function Function taking an id and returning its new key
+    template <typename Function>
+    void rekey(Function function) {
+        for (Entry& entry : m_heap) {
+            entry.key = function(entry.id);
+        }
+        for (int position = static_cast<int>(m_heap.size()) / Arity;
+             position >= 0; --position) {
+            if (position < static_cast<int>(m_heap.size())) {
+                sift_down(position);
+            }
+        }
+    }
+
+    /// Removes all ids
+    void clear() {
+        for (const Entry& entry : m_heap) {
+            m_positions[entry.id] = -1;
+        }
+        m_heap.clear();
+    }
+
+ private:
+    struct Entry {
+        Key key;
+        int id;
+    };
+
+    void remove_at(const int position) {
+        m_positions[m_heap[position].id] = -1;
+        const int last = m_heap.size() - 1;
+        if (position != last) {
+            const int moved = m_heap[last].id;
+            move(last, position);
+            m_heap.pop_back();
+            sift_up(position);
+            if (m_positions[moved] == position) {
+                sift_down(position);
+            }
+        } else {
+            m_heap.pop_back();
+        }
+    }
+
+    void sift_up(int position) {
+        const Entry entry = m_heap[position];
+        while (position > 0) {
+            const int parent = (position - 1) / Arity;
+            if (!(entry.key < m_heap[parent].key)) {
+                break;
+            }
+            move(parent, position);
+            position = parent;
+        }
+        m_heap[position] = entry;
+        m_positions[entry.id] = position;
+    }
+
+    void sift_down(int position) {
+        const Entry entry = m_heap[position];
+        const int size = m_heap.size();
+        while (true) {
+            const int first = position * Arity + 1;
+            if (first >= size) {
+                break;
+            }
+            const int end = first + Arity < size ? first + Arity : size;
+            int best = first;
+            for (int child = first + 1; child < end; ++child) {
+                if (m_heap[child].key < m_heap[best].key) {
+                    best = child;
+                }
+            }
+            if (!(m_heap[best].key < entry.key)) {
+                break;
+            }
+            move(best, position);
+            position = best;
+        }
+        m_heap[position] = entry;
+        m_positions[entry.id] = position;
+    }
+
+    /// Moves the entry at one position to another
+    void move(const int from, const int to) {
+        m_heap[to] = m_heap[from];
+        m_positions[m_heap[to].id] = to;
+    }
+
+    std::vector<Entry> m_heap;
+    /// Position of each id in m_heap; -1 if the id is not in the heap
+    std::vector<int> m_positions;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_DARYHEAP_HPP_
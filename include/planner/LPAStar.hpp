@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef INCLUDE_PLANNER_LPASTAR_HPP_
+#define INCLUDE_PLANNER_LPASTAR_HPP_
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "actionspace/ActionSpace.hpp"
+#include "distance/distance.hpp"
+#include "model/Model.hpp"
+#include "planner/DaryHeap.hpp"
+#include "planner/SE2Successors.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+
+/// This class implements lifelong planning A* (LPA*) over a discrete SE2
+/// statespace, for replanning after small changes of the world
+///
+/// Like WeightedAStar, successors are the model predictions of every action
+/// and the cost of an edge is by default the distance between its states.
+/// Edges are kept once predicted, so the model is called at most once per
+/// state over the lifetime of the planner. After a solve, edge costs and
+/// state validity may change, e.g. when an obstacle moves, and the goal may
+/// move; replan() then repairs the previous search, which only processes
+/// the states whose start distance changed.
+///
+/// The heuristic is the distance to the goal, so edge costs must not be
+/// less than the distance between their states. The returned paths are
+/// optimal.
+class LPAStar {
+ public:
+    /// Search statistics of the last solve or replan
+    struct Statistics {
+        Statistics() :
+            num_expansions(0),
+            num_model_calls(0),
+            path_cost(0),
+            seconds(0) {}
+
+        /// Number of processed states
+        int num_expansions;
+        /// Number of (batched) model predictions
+        int num_model_calls;
+        /// Cost of the returned path
+        double path_cost;
+        /// Wall clock time of the search (seconds)
+        double seconds;
+    };
+
+    /// Constructs the planner
+    ///
+    /// \param statespace The statespace states are registered in
+    /// \param actionspace The actions applied to every state
+    /// \param model The model that predicts the next state
+    /// \param distance Metric of the edge costs and the heuristic
+    LPAStar(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<actionspace::ActionSpace> actionspace,
+        const std::shared_ptr<model::Model> model,
+        const std::shared_ptr<distance::Distance> distance);
+
+    ~LPAStar() = default;
+
+    /// Searches a path from the start state to the goal state, discarding
+    /// any previous search. Edge costs and state validity notified so far
+    /// are kept
+    ///
+    /// \param start The start state
+    /// \param goal The goal state
+    /// \param[out] actions Action ids of the path
+    /// \param[out] states State ids of the path, start and goal included;
+    /// optional
+    /// \return True if a path was found; false otherwise
+    bool solve(
+        const statespace::SE2::State& start,
+        const statespace::SE2::State& goal,
+        std::vector<int>* actions,
+        std::vector<int>* states = nullptr);
+
+    /// Repairs the previous search after the notified changes and gets the
+    /// new path
+    ///
+    /// \param[out] actions Action ids of the path
+    /// \param[out] states State ids of the path, start and goal included;
+    /// optional
+    /// \return True if a path was found; false otherwise or if solve() was
+    /// not called
+    bool replan(std::vector<int>* actions, std::vector<int>* states = nullptr);
+
+    /// Moves the goal, keeping the start distances of the previous search
+    ///
+    /// \param goal The new goal state
+    void set_goal(const statespace::SE2::State& goal);
+
+    /// Changes the cost of the edge of an action from a state
+    ///
+    /// \param state_id Id of the state
+    /// \param action_id Id of the action
+    /// \param cost The new cost, infinite if the edge is blocked; if
+    /// negative, the distance between the states of the edge
+    void set_edge_cost(
+        const int& state_id, const int& action_id, const double& cost);
+
+    /// Changes whether a state may be visited, e.g. whether it is in
+    /// collision
+    ///
+    /// \param state_id Id of the state
+    /// \param valid Whether the state may be visited
+    void set_state_validity(const int& state_id, const bool& valid);
+
+    /// Gets the statistics of the last solve or replan
+    const Statistics& get_statistics() const;
+
+ private:
+    /// Search data of a state
+    struct Node {
+        /// Start distance found by the last expansion
+        double g;
+        /// One step lookahead start distance
+        double rhs;
+        /// Heuristic; negative if not computed yet
+        double h;
+        /// Whether the state may be visited
+        bool valid;
+        /// Whether the outgoing edges were predicted
+        bool expanded;
+        /// Ids of the outgoing edges
+        std::vector<int> successors;
+        /// Ids of the incoming edges
+        std::vector<int> predecessors;
+    };
+
+    /// Edge of the predicted graph
+    struct Edge {
+        /// Id of the source state
+        int source;
+        /// Id of the target state
+        int target;
+        /// Id of the action
+        int action;
+        /// Current cost
+        double cost;
+    };
+
+    /// Priority in the open list, (min(g, rhs) + h, min(g, rhs))
+    typedef std::pair<double, double> Key;
+
+    /// Gets the search data of a state, growing the table if needed
+    Node& node(const int& state_id);
+
+    /// Gets the heuristic of a state, computing it once per goal
+    double heuristic(const int& state_id);
+
+    /// Gets the priority of a state
+    Key key(const int& state_id);
+
+    /// Gets the cost of an edge from the notified costs
+    double edge_cost(
+        const int& source, const int& target, const int& action) const;
+
+    /// Predicts the outgoing edges of a state, once
+    void expand(const int& state_id);
+
+    /// Recomputes the lookahead start distance of a state and queues it if
+    /// it is inconsistent
+    void update_state(const int& state_id);
+
+    /// Processes inconsistent states until the goal is consistent and not
+    /// above the open list
+    void compute_shortest_path();
+
+    /// Follows the best predecessors from the goal to the start
+    bool extract_path(std::vector<int>* actions, std::vector<int>* states);
+
+    const SE2Successors m_successors;
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<distance::Distance> m_distance;
+
+    std::vector<Node> m_nodes;
+    std::vector<Edge> m_edges;
+    /// Notified edge costs, by (state id, action id)
+    std::map<std::pair<int, int>, double> m_edge_costs;
+    DaryHeap<Key> m_open;
+    int m_start_id;
+    int m_goal_id;
+    statespace::SE2::State m_goal;
+    Statistics m_statistics;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_LPASTAR_HPP_
@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef INCLUDE_PLANNER_LAZYWEIGHTEDASTAR_HPP_
+#define INCLUDE_PLANNER_LAZYWEIGHTEDASTAR_HPP_
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "actionspace/ActionSpace.hpp"
+#include "distance/distance.hpp"
+#include "model/Model.hpp"
+#include "planner/DaryHeap.hpp"
+#include "planner/SE2Successors.hpp"
+#include "planner/SearchTable.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+
+/// This class implements lazy weighted A* (LWA*) over a discrete SE2
+/// statespace
+///
+/// Expanding a state only predicts its successors with a cheap estimate
+/// model (e.g. model::UnicycleModel) and queues one lazy edge per action,
+/// prioritized by the estimated edge cost and the heuristic of the
+/// estimated successor. The expensive model is called for an edge only
+/// when the edge reaches the top of the open list; its true successor is
+/// then queued with the true cost. So the expensive model is called about
+/// once per expansion instead of once per action.
+///
+/// Edge costs and the heuristic are distances under the given metric. If
+/// the estimates are optimistic (i.e. the estimated priority of an edge is
+/// not above the true one), the returned path costs at most weight times
+/// the optimal cost.
+///
+/// Edges are only discarded by their true successor, after evaluation.
+/// Parameters::prune_estimates additionally drops a lazy edge, without
+/// calling the expensive model, once its estimated successor is reached at
+/// no higher cost. This is only sound if the estimate model predicts the
+/// same cells as the expensive model, so it is disabled by default.
+class LazyWeightedAStar {
+ public:
+    /// Tuning parameters of the planner
+    struct Parameters {
+        Parameters() :
+            weight(1.0),
+            goal_tolerance(0.0),
+            max_expansions(0),
+            prune_estimates(false) {}
+
+        /// Heuristic inflation, at least 1
+        double weight;
+        /// A state is a goal if its distance to the goal state is at most
+        /// this tolerance
+        double goal_tolerance;
+        /// Maximum number of expansions; if not positive, unlimited
+        int max_expansions;
+        /// Whether to drop lazy edges whose estimated successor is already
+        /// reached at no higher cost; only sound if the estimate model
+        /// predicts the same cells as the expensive model
+        bool prune_estimates;
+    };
+
+    /// Search statistics of the last solve
+    struct Statistics {
+        Statistics() :
+            num_expansions(0),
+            num_estimates(0),
+            num_evaluations(0),
+            num_pruned(0),
+            path_cost(0),
+            seconds(0) {}
+
+        /// Number of expanded states
+        int num_expansions;
+        /// Number of successors predicted by the estimate model
+        int num_estimates;
+        /// Number of edges evaluated by the expensive model
+        int num_evaluations;
+        /// Number of lazy edges dropped without evaluation
+        int num_pruned;
+        /// Cost of the returned path
+        double path_cost;
+        /// Wall clock time of the solve (seconds)
+        double seconds;
+    };
+
+    /// Constructs the planner
+    ///
+    /// \param statespace The statespace states are registered in
+    /// \param actionspace The actions applied to every state
+    /// \param model The expensive model that predicts the next state
+    /// \param estimate_model The cheap model that estimates the next state
+    /// \param distance Metric of the edge costs and the heuristic
+    /// \param parameters Tuning parameters
+    LazyWeightedAStar(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<actionspace::ActionSpace> actionspace,
+        const std::shared_ptr<model::Model> model,
+        const std::shared_ptr<model::Model> estimate_model,
+        const std::shared_ptr<distance::Distance> distance,
+        const Parameters& parameters = Parameters());
+
+    ~LazyWeightedAStar() = default;
+
+    /// Searches a path from the start state to the goal state
+    ///
+    /// \param start The start state
+    /// \param goal The goal state
+    /// \param[out] actions Action ids of the path
+    /// \param[out] states State ids of the path, start and reached goal
+    /// included; optional
+    /// \return True if a path was found; false otherwise
+    bool solve(
+        const statespace::SE2::State& start,
+        const statespace::SE2::State& goal,
+        std::vector<int>* actions,
+        std::vector<int>* states = nullptr);
+
+    /// Gets the statistics of the last solve
+    const Statistics& get_statistics() const;
+
+    /// Gets the tuning parameters
+    const Parameters& get_parameters() const;
+
+ private:
+    /// Edge whose successor was only estimated
+    struct LazyEdge {
+        /// Estimated successor
+        statespace::SE2::State successor;
+        /// Estimated cost of the path through the edge
+        double g;
+    };
+
+    /// Priority in the open list, (f, h)
+    typedef std::pair<double, double> Key;
+
+    /// Gets the heuristic of a state, computing it once
+    double heuristic(const int& state_id, const statespace::SE2::State& goal);
+
+    /// Gets the open list id of a state
+    int state_entry(const int& state_id) const;
+
+    /// Gets the open list id of the lazy edge of an action from a state
+    int edge_entry(const int& state_id, const int& action_id) const;
+
+    /// Whether the estimated successor of a lazy edge is already reached at
+    /// no higher cost
+    bool is_dominated(const LazyEdge& edge) const;
+
+    /// Expands a state, queuing a lazy edge for every action
+    void expand(const int& state_id, const statespace::SE2::State& goal);
+
+    /// Evaluates a lazy edge with the expensive model and queues its
+    /// successor
+    void evaluate(
+        const int& state_id,
+        const int& action_id,
+        const statespace::SE2::State& goal);
+
+    const SE2Successors m_successors;
+    const SE2Successors m_estimates;
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<distance::Distance> m_distance;
+    const Parameters m_parameters;
+    const int m_num_actions;
+
+    SearchTable m_table;
+    /// Holds both states and lazy edges, see state_entry() and edge_entry()
+    DaryHeap<Key> m_open;
+    /// Lazy edges in the open list, by open list id
+    std::unordered_map<int, LazyEdge> m_lazy_edges;
+    std::vector<statespace::SE2::State> m_estimated_states;
+    Statistics m_statistics;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_LAZYWEIGHTEDASTAR_HPP_
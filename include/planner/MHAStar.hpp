@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef INCLUDE_PLANNER_MHASTAR_HPP_
+#define INCLUDE_PLANNER_MHASTAR_HPP_
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "actionspace/ActionSpace.hpp"
+#include "distance/distance.hpp"
+#include "model/Model.hpp"
+#include "planner/DaryHeap.hpp"
+#include "planner/SE2Successors.hpp"
+#include "planner/SearchTable.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+
+/// This class implements shared multi-heuristic A* (SMHA*) over a discrete
+/// SE2 statespace
+///
+/// The search runs one open list per heuristic, all sharing the same
+/// g-values and parents. The anchor heuristic is the distance to the goal
+/// under the metric of the edge costs, which is admissible; the other
+/// heuristics may be inadmissible, e.g. distances that weigh translation
+/// (approach) or orientation (alignment) differently (see
+/// distance::WeightedSE2). The inadmissible open lists take turns in round
+/// robin order, and one is only expanded from while its smallest priority
+/// is within anchor_weight times the one of the anchor; otherwise the
+/// anchor is expanded from. A state is expanded at most once by the anchor
+/// and at most once by the inadmissible lists together.
+///
+/// Priorities are g + heuristic_weight * h. For a consistent anchor, the
+/// returned path costs at most heuristic_weight * anchor_weight times the
+/// optimal cost.
+class MHAStar {
+ public:
+    /// Tuning parameters of the planner
+    struct Parameters {
+        Parameters() :
+            heuristic_weight(2.0),
+            anchor_weight(2.0),
+            goal_tolerance(0.0),
+            max_expansions(0) {}
+
+        /// Inflation of every heuristic, at least 1
+        double heuristic_weight;
+        /// Bound of the inadmissible priorities relative to the anchor, at
+        /// least 1
+        double anchor_weight;
+        /// A state is a goal if its distance to the goal state is at most
+        /// this tolerance
+        double goal_tolerance;
+        /// Maximum number of expansions; if not positive, unlimited
+        int max_expansions;
+    };
+
+    /// Search statistics of the last solve
+    struct Statistics {
+        Statistics() :
+            num_expansions(0),
+            path_cost(0),
+            seconds(0) {}
+
+        /// Number of expansions, anchor and inadmissible together
+        int num_expansions;
+        /// Number of expansions from each open list, the anchor first
+        std::vector<int> queue_expansions;
+        /// Cost of the returned path
+        double path_cost;
+        /// Wall clock time of the solve (seconds)
+        double seconds;
+    };
+
+    /// Constructs the planner
+    ///
+    /// \param statespace The statespace states are registered in
+    /// \param actionspace The actions applied to every state
+    /// \param model The model that predicts the next state
+    /// \param distance Metric of the edge costs and the anchor heuristic
+    /// \param heuristics Metrics of the inadmissible heuristics
+    /// \param parameters Tuning parameters
+    MHAStar(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<actionspace::ActionSpace> actionspace,
+        const std::shared_ptr<model::Model> model,
+        const std::shared_ptr<distance::Distance> distance,
+        const std::vector<std::shared_ptr<distance::Distance>>& heuristics,
+        const Parameters& parameters = Parameters());
+
+    ~MHAStar() = default;
+
+    /// Searches a path from the start state to the goal state
+    ///
+    /// \param start The start state
+    /// \param goal The goal state
+    /// \param[out] actions Action ids of the path
+    /// \param[out] states State ids of the path, start and reached goal
+    /// included; optional
+    /// \return True if a path was found; false otherwise
+    bool solve(
+        const statespace::SE2::State& start,
+        const statespace::SE2::State& goal,
+        std::vector<int>* actions,
+        std::vector<int>* states = nullptr);
+
+    /// Gets the statistics of the last solve
+    const Statistics& get_statistics() const;
+
+    /// Gets the tuning parameters
+    const Parameters& get_parameters() const;
+
+ private:
+    /// Priority in an open list, (f, h)
+    typedef std::pair<double, double> Key;
+
+    /// Gets the priority of a state in an open list; 0 is the anchor
+    Key key(const int& state_id, const int& queue) const;
+
+    /// Gets the anchor heuristic of a state, computing it once
+    double heuristic(const int& state_id);
+
+    /// Whether a state was expanded from an inadmissible open list
+    bool is_closed_inadmissible(const int& state_id) const;
+
+    /// Expands a state from an open list, removing it from all of them
+    void expand(const int& state_id, const int& queue);
+
+    const SE2Successors m_successors;
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<distance::Distance> m_distance;
+    const std::vector<std::shared_ptr<distance::Distance>> m_heuristics;
+    const Parameters m_parameters;
+
+    statespace::SE2::State m_goal;
+    /// Cheapest reached goal state; -1 if none
+    int m_goal_id;
+    /// Anchor data; closed flags are those of the anchor
+    SearchTable m_table;
+    /// Open lists, the anchor first
+    std::vector<DaryHeap<Key>> m_open;
+    /// States expanded from the inadmissible open lists
+    std::vector<int> m_closed_inadmissible;
+    std::vector<bool> m_is_closed_inadmissible;
+    Statistics m_statistics;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_MHASTAR_HPP_
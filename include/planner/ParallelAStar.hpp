@@ -0,0 +1,260 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef INCLUDE_PLANNER_PARALLELASTAR_HPP_
+#define INCLUDE_PLANNER_PARALLELASTAR_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "actionspace/ActionSpace.hpp"
+#include "distance/distance.hpp"
+#include "model/Model.hpp"
+#include "planner/DaryHeap.hpp"
+#include "planner/SE2Successors.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+
+/// This class implements hash distributed A* (HDA*) over a discrete SE2
+/// statespace
+///
+/// Every state is owned by one search thread, chosen by the hash of the
+/// state. Each thread keeps the search data and the open list of the states
+/// it owns and expands them; successors owned by other threads are sent to
+/// their owner, which relaxes them when it drains its inbox. Since the
+/// expansion order is not globally best first, states may be reopened.
+///
+/// A state within the goal tolerance is recorded as the incumbent solution
+/// when it is generated and is not expanded. States whose priority
+/// f = g + weight * h is not below the incumbent cost are pruned, and the
+/// search ends once every thread is out of work and no message is in
+/// flight. For a consistent heuristic the returned path costs at most
+/// weight times the optimal cost.
+///
+/// Model predictions run concurrently if the model is thread safe (see
+/// model::Model::is_thread_safe()); otherwise they are serialized, and only
+/// the search bookkeeping runs in parallel. The distance must support
+/// concurrent calls to its const functions.
+class ParallelAStar {
+ public:
+    /// Tuning parameters of the planner
+    struct Parameters {
+        Parameters() :
+            weight(1.0),
+            goal_tolerance(0.0),
+            num_threads(0) {}
+
+        /// Heuristic inflation, at least 1
+        double weight;
+        /// A state is a goal if its distance to the goal state is at most
+        /// this tolerance
+        double goal_tolerance;
+        /// Number of search threads; if not positive, the number of
+        /// hardware threads
+        int num_threads;
+    };
+
+    /// Search statistics of the last solve
+    struct Statistics {
+        Statistics() :
+            num_expansions(0),
+            num_generated(0),
+            num_messages(0),
+            expansions_per_second(0),
+            path_cost(0),
+            seconds(0) {}
+
+        /// Number of expansions, reexpansions included
+        int num_expansions;
+        /// Number of generated successors
+        int num_generated;
+        /// Number of successors sent to another thread
+        int num_messages;
+        /// Number of expansions of each thread
+        std::vector<int> thread_expansions;
+        /// Expansion throughput of the search
+        double expansions_per_second;
+        /// Cost of the returned path
+        double path_cost;
+        /// Wall clock time of the solve (seconds)
+        double seconds;
+    };
+
+    /// Constructs the planner
+    ///
+    /// \param statespace The statespace states are registered in
+    /// \param actionspace The actions applied to every state
+    /// \param model The model that predicts the next state
+    /// \param distance Metric of the edge costs and the heuristic
+    /// \param parameters Tuning parameters
+    ParallelAStar(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<actionspace::ActionSpace> actionspace,
+        const std::shared_ptr<model::Model> model,
+        const std::shared_ptr<distance::Distance> distance,
+        const Parameters& parameters = Parameters());
+
+    ~ParallelAStar() = default;
+
+    /// Searches a path from the start state to the goal state
+    ///
+    /// \param start The start state
+    /// \param goal The goal state
+    /// \param[out] actions Action ids of the path
+    /// \param[out] states State ids of the path, start and reached goal
+    /// included; optional
+    /// \return True if a path was found; false otherwise
+    bool solve(
+        const statespace::SE2::State& start,
+        const statespace::SE2::State& goal,
+        std::vector<int>* actions,
+        std::vector<int>* states = nullptr);
+
+    /// Gets the number of search threads
+    int num_threads() const;
+
+    /// Gets the statistics of the last solve
+    const Statistics& get_statistics() const;
+
+    /// Gets the tuning parameters
+    const Parameters& get_parameters() const;
+
+ private:
+    /// Search data of a state
+    struct Node {
+        /// Cost of the best known path from the start
+        double g;
+        /// Heuristic
+        double h;
+        /// Predecessor state id on the best known path; -1 if none
+        int parent;
+        /// Action from the predecessor
+        int action;
+        /// The state
+        statespace::SE2::State state;
+    };
+
+    /// A path to a state, sent to the owner of the state
+    struct Message {
+        /// Id of the state
+        int state_id;
+        /// Cost of the path
+        double g;
+        /// Predecessor state id on the path
+        int parent;
+        /// Action from the predecessor
+        int action;
+        /// The state
+        statespace::SE2::State state;
+    };
+
+    /// Priority in an open list, (f, h)
+    typedef std::pair<double, double> Key;
+
+    /// Search data of one thread
+    struct Worker {
+        /// Search data of the owned states
+        std::unordered_map<int, Node> nodes;
+        /// Open list of the owned states
+        DaryHeap<Key> open;
+        /// Paths received from other threads
+        std::vector<Message> inbox;
+        /// Guards the inbox
+        std::mutex inbox_mutex;
+        /// Number of expansions
+        int num_expansions;
+        /// Number of generated successors
+        int num_generated;
+        /// Number of sent messages
+        int num_messages;
+    };
+
+    /// Gets the thread that owns a state
+    int owner(const statespace::SE2::State& state) const;
+
+    /// Runs the search loop of a thread
+    void search(const int& thread_id, const statespace::SE2::State& goal);
+
+    /// Relaxes a path to a state owned by the thread
+    void relax(
+        Worker* worker,
+        const Message& message,
+        const statespace::SE2::State& goal);
+
+    /// Sends a path to the owner of its state
+    void send(const int& thread_id, const Message& message);
+
+    /// Waits for a message while the thread is out of work
+    ///
+    /// \return True if the search is over; false if a message arrived
+    bool wait_for_work(const int& thread_id);
+
+    /// Finds the search data of a state after the search
+    const Node* find_node(const int& state_id) const;
+
+    const SE2Successors m_successors;
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<distance::Distance> m_distance;
+    const Parameters m_parameters;
+    const int m_num_threads;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+
+    /// Id of the best goal state generated so far; -1 if none
+    int m_goal_id;
+    /// Cost of the best goal state generated so far
+    std::atomic<double> m_goal_cost;
+    /// Guards the incumbent goal state
+    std::mutex m_goal_mutex;
+
+    /// Number of sent messages not processed yet
+    std::atomic<int> m_num_in_flight;
+    /// Number of threads out of work
+    std::atomic<int> m_num_idle;
+    /// Whether the search is over
+    bool m_done;
+    /// Guards the termination state
+    std::mutex m_termination_mutex;
+    /// Wakes up threads out of work
+    std::condition_variable m_termination_condition;
+
+    Statistics m_statistics;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_PARALLELASTAR_HPP_
@@ -0,0 +1,155 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_PLANNER_SE2SUCCESSORS_HPP_
+#define INCLUDE_PLANNER_SE2SUCCESSORS_HPP_
+
+#include <Eigen/Dense>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "actionspace/ActionSpace.hpp"
+#include "model/Model.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+
+/// Expands discrete SE2 states by applying every action of an action space
+/// through a model
+///
+/// The action vectors are cached at construction. Expanding a state runs
+/// one batched model prediction over all actions, converts the predicted
+/// [x, y, theta] vectors to discrete states and registers them in the
+/// statespace.
+///
+/// All functions can be called concurrently: statespace accesses are
+/// serialized, and so are model predictions if the model is not thread
+/// safe.
+class SE2Successors {
+ public:
+    /// Successor of a state
+    struct Successor {
+        /// Action that leads to the successor
+        int action_id;
+        /// State id of the successor
+        int state_id;
+        /// The successor
+        statespace::SE2::State state;
+    };
+
+    /// Constructs the successor generator
+    ///
+    /// \param statespace The statespace the states are registered in
+    /// \param actionspace The actions applied to every state
+    /// \param model The model that predicts the next state
+    SE2Successors(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<actionspace::ActionSpace> actionspace,
+        const std::shared_ptr<model::Model> model);
+
+    ~SE2Successors() = default;
+
+    /// Gets the successors of a state. Actions whose predicted state falls
+    /// in the cell of the expanded state are skipped
+    ///
+    /// \param state_id Id of the expanded state
+    /// \param[out] successors The successors
+    /// \return True if the model prediction succeeded; false otherwise
+    bool get_successors(
+        const int& state_id, std::vector<Successor>* successors) const;
+
+    /// Predicts the successor of a state for every action, in action order,
+    /// without registering them in the statespace
+    ///
+    /// \param state The state
+    /// \param[out] successors The successor of each action
+    /// \return True if the model prediction succeeded; false otherwise
+    bool predict_successors(
+        const statespace::SE2::State& state,
+        std::vector<statespace::SE2::State>* successors) const;
+
+    /// Predicts the successor of a state for one action
+    ///
+    /// \param state_id Id of the state
+    /// \param action_id Id of the applied action
+    /// \param[out] successor_id State id of the successor
+    /// \return True if the model prediction succeeded; false otherwise
+    bool get_successor(
+        const int& state_id,
+        const int& action_id,
+        int* successor_id) const;
+
+    /// Gets a copy of a state
+    ///
+    /// \param state_id Id of the state
+    /// \param[out] state The state
+    /// \return True if the state exists; false otherwise
+    bool get_state(const int& state_id, statespace::SE2::State* state) const;
+
+    /// Gets the id of a state, registering it if it is new
+    ///
+    /// \param state The state
+    /// \return Id of the state
+    int get_or_create_state(const statespace::SE2::State& state) const;
+
+    /// Gets the number of actions
+    int num_actions() const;
+
+    /// Gets the cached action vectors, one per row
+    const Eigen::MatrixXd& action_vectors() const;
+
+    /// Gets the statespace
+    std::shared_ptr<statespace::SE2> statespace() const;
+
+    /// Gets the model
+    std::shared_ptr<model::Model> model() const;
+
+ private:
+    /// Predicts the end states of a batch, serialized if the model is not
+    /// thread safe
+    bool predict_states(
+        const Eigen::MatrixXd& actions,
+        const Eigen::MatrixXd& states,
+        Eigen::MatrixXd* output_states) const;
+
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<model::Model> m_model;
+    Eigen::MatrixXd m_actions;
+
+    /// Guards the statespace
+    mutable std::mutex m_statespace_mutex;
+    /// Guards the model if it is not thread safe
+    mutable std::mutex m_model_mutex;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_SE2SUCCESSORS_HPP_
@@ -0,0 +1,169 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef INCLUDE_PLANNER_SEARCHTABLE_HPP_
+#define INCLUDE_PLANNER_SEARCHTABLE_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace libcozmo {
+namespace planner {
+
+/// Search data of the states of a statespace, indexed by state id and
+/// reused across queries
+///
+/// The data is stored as one array per field (g, heuristic, parent,
+/// action, closed flag), grown on demand as the statespace grows. Each
+/// entry is stamped with the query that wrote it, so reset() starts a new
+/// query in O(1) and entries of earlier queries read as unvisited until
+/// they are written again. The closed flags have their own stamp, so that
+/// searches that reexpand states (e.g. ARA*) can reopen all states in O(1)
+/// too.
+class SearchTable {
+ public:
+    SearchTable();
+
+    ~SearchTable() = default;
+
+    /// Starts a new query; every state becomes unvisited
+    void reset();
+
+    /// Marks every state as not expanded, keeping the rest of the data
+    void reset_closed();
+
+    /// Grows the arrays to hold the given number of states
+    ///
+    /// \param num_states Number of states, e.g. the statespace size
+    void reserve(const int& num_states);
+
+    /// Gets the number of states the arrays hold
+    int size() const { return m_stamps.size(); }
+
+    /// Whether a state was written since the last reset
+    bool visited(const int& id) const {
+        return id < size() && m_stamps[id] == m_query;
+    }
+
+    /// Gets the cost of the best known path to a state; infinite if the
+    /// state was not visited
+    double g(const int& id) const {
+        return visited(id) ? m_g[id] : std::numeric_limits<double>::infinity();
+    }
+
+    /// Gets the heuristic of a state; negative if not computed
+    double h(const int& id) const { return visited(id) ? m_h[id] : -1.0; }
+
+    /// Gets the predecessor of a state; -1 if none
+    int parent(const int& id) const { return visited(id) ? m_parent[id] : -1; }
+
+    /// Gets the action from the predecessor of a state; -1 if none
+    int action(const int& id) const { return visited(id) ? m_action[id] : -1; }
+
+    /// Whether a state was expanded since the last reset of the closed
+    /// flags
+    bool closed(const int& id) const {
+        return visited(id) && m_closed[id] == m_closed_query;
+    }
+
+    /// Sets the cost of the best known path to a state
+    void set_g(const int& id, const double& g) {
+        visit(id);
+        m_g[id] = g;
+    }
+
+    /// Sets the heuristic of a state
+    void set_h(const int& id, const double& h) {
+        visit(id);
+        m_h[id] = h;
+    }
+
+    /// Sets the predecessor of a state and the action from it
+    void set_parent(const int& id, const int& parent, const int& action) {
+        visit(id);
+        m_parent[id] = parent;
+        m_action[id] = action;
+    }
+
+    /// Marks a state as expanded
+    void set_closed(const int& id) {
+        visit(id);
+        m_closed[id] = m_closed_query;
+    }
+
+    /// Gets the path to a state by following the predecessors back to the
+    /// start
+    ///
+    /// \param goal_id State at the end of the path
+    /// \param[out] actions Actions along the path, from start to goal
+    /// \param[out] states State ids along the path, from start to goal;
+    /// ignored if nullptr
+    void extract_path(
+        const int& goal_id,
+        std::vector<int>* actions,
+        std::vector<int>* states) const;
+
+ private:
+    typedef std::uint32_t Stamp;
+
+    /// Initializes the entry of a state if it is stale
+    void visit(const int& id) {
+        if (id >= size()) {
+            grow(id + 1);
+        }
+        if (m_stamps[id] != m_query) {
+            m_stamps[id] = m_query;
+            m_g[id] = std::numeric_limits<double>::infinity();
+            m_h[id] = -1.0;
+            m_parent[id] = -1;
+            m_action[id] = -1;
+            m_closed[id] = 0;
+        }
+    }
+
+    /// Grows the arrays to at least the given size, geometrically
+    void grow(const int& num_states);
+
+    /// Stamps of the entries; 0 is never a current stamp
+    std::vector<Stamp> m_stamps;
+    std::vector<double> m_g;
+    std::vector<double> m_h;
+    std::vector<int> m_parent;
+    std::vector<int> m_action;
+    std::vector<Stamp> m_closed;
+    Stamp m_query;
+    Stamp m_closed_query;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_SEARCHTABLE_HPP_
@@ -0,0 +1,154 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_PLANNER_WEIGHTEDASTAR_HPP_
+#define INCLUDE_PLANNER_WEIGHTEDASTAR_HPP_
+
+#include <memory>
+#include <utility>
+#include <vector>
+#include "actionspace/ActionSpace.hpp"
+#include "distance/distance.hpp"
+#include "model/Model.hpp"
+#include "planner/DaryHeap.hpp"
+#include "planner/SE2Successors.hpp"
+#include "planner/SearchTable.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+
+/// This class implements weighted A* over a discrete SE2 statespace
+///
+/// Successors of a state are the predictions of the model for every action
+/// of the action space. The cost of an edge is the distance between its
+/// states, and the heuristic is the distance to the goal inflated by the
+/// weight, both under the given metric; so for a metric the returned path
+/// costs at most weight times the optimal cost. States are expanded at
+/// most once.
+///
+/// Search data is kept in a SearchTable, which is reused across solves
+/// without clearing, and the open list is an indexed d-ary heap ordered by
+/// f = g + weight * h, ties broken towards smaller h.
+class WeightedAStar {
+ public:
+    /// Tuning parameters of the planner
+    struct Parameters {
+        Parameters() :
+            weight(1.0),
+            goal_tolerance(0.0),
+            max_expansions(0) {}
+
+        /// Heuristic inflation, at least 1
+        double weight;
+        /// A state is a goal if its distance to the goal state is at most
+        /// this tolerance
+        double goal_tolerance;
+        /// Maximum number of expansions; if not positive, unlimited
+        int max_expansions;
+    };
+
+    /// Search statistics of the last solve
+    struct Statistics {
+        Statistics() :
+            num_expansions(0),
+            num_generated(0),
+            num_model_calls(0),
+            path_cost(0),
+            seconds(0) {}
+
+        /// Number of expanded states
+        int num_expansions;
+        /// Number of generated successors
+        int num_generated;
+        /// Number of (batched) model predictions
+        int num_model_calls;
+        /// Cost of the returned path
+        double path_cost;
+        /// Wall clock time of the solve (seconds)
+        double seconds;
+    };
+
+    /// Constructs the planner
+    ///
+    /// \param statespace The statespace states are registered in
+    /// \param actionspace The actions applied to every state
+    /// \param model The model that predicts the next state
+    /// \param distance Metric of the edge costs and the heuristic
+    /// \param parameters Tuning parameters
+    WeightedAStar(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<actionspace::ActionSpace> actionspace,
+        const std::shared_ptr<model::Model> model,
+        const std::shared_ptr<distance::Distance> distance,
+        const Parameters& parameters = Parameters());
+
+    ~WeightedAStar() = default;
+
+    /// Searches a path from the start state to the goal state
+    ///
+    /// \param start The start state
+    /// \param goal The goal state
+    /// \param[out] actions Action ids of the path
+    /// \param[out] states State ids of the path, start and reached goal
+    /// included; optional
+    /// \return True if a path was found; false otherwise
+    bool solve(
+        const statespace::SE2::State& start,
+        const statespace::SE2::State& goal,
+        std::vector<int>* actions,
+        std::vector<int>* states = nullptr);
+
+    /// Gets the statistics of the last solve
+    const Statistics& get_statistics() const;
+
+    /// Gets the tuning parameters
+    const Parameters& get_parameters() const;
+
+ private:
+    /// Priority in the open list, (f, h)
+    typedef std::pair<double, double> Key;
+
+    /// Gets the heuristic of a state, computing it once
+    double heuristic(const int& state_id, const statespace::SE2::State& goal);
+
+    const SE2Successors m_successors;
+    const std::shared_ptr<statespace::SE2> m_statespace;
+    const std::shared_ptr<distance::Distance> m_distance;
+    const Parameters m_parameters;
+
+    SearchTable m_table;
+    DaryHeap<Key> m_open;
+    Statistics m_statistics;
+};
+
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // INCLUDE_PLANNER_WEIGHTEDASTAR_HPP_
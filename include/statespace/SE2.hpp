@@ -37,6 +37,7 @@
 #include <utility>
 #include <boost/functional/hash.hpp>
 #include "StateSpace.hpp"
+#include "utils/HeadingTable.hpp"
 
 namespace libcozmo {
 namespace statespace {
@@ -97,7 +98,8 @@ class SE2 : public virtual StateSpace {
         m_resolution(resolution_m),
         m_num_theta_vals(num_theta_vals),
         m_statespace(std::make_shared<aikido::statespace::SE2>()),
-        m_distance_metric(aikido::distance::SE2(m_statespace)) {}
+        m_distance_metric(aikido::distance::SE2(m_statespace)),
+        m_headings(utils::HeadingTable::get(num_theta_vals)) {}
 
     ~SE2();
 
@@ -155,6 +157,25 @@ class SE2 : public virtual StateSpace {
     /// Documentation inherited
     double get_resolution() const override;
 
+    /// Gets the number of discretized theta values
+    int get_num_theta_vals() const;
+
+    /// Converts discrete state to continuous state vector
+    ///
+    /// \param _state Discrete state
+    /// \param[out] _continuous_state Vector in format [x, y, theta]
+    void discrete_state_to_vector(
+        const StateSpace::State& _state,
+        Eigen::Vector3d* _continuous_state) const;
+
+    /// Converts continuous state vector to discrete state
+    ///
+    /// \param _continuous_state Vector in format [x, y, theta]
+    /// \param[out] _state Discrete state
+    void vector_to_discrete_state(
+        const Eigen::Vector3d& _continuous_state,
+        StateSpace::State* _state) const;
+
  private:
     /// Creates a new state and adds it to the statespace
     ///
@@ -208,6 +229,9 @@ class SE2 : public virtual StateSpace {
 
     std::shared_ptr<aikido::statespace::SE2> m_statespace;
     aikido::distance::SE2 m_distance_metric;
+
+    /// Headings of the discretized theta values
+    const std::shared_ptr<const utils::HeadingTable> m_headings;
 };
 
 }  // namespace statespace
@@ -0,0 +1,96 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_UTILS_HEADINGTABLE_HPP_
+#define INCLUDE_UTILS_HEADINGTABLE_HPP_
+
+#include <memory>
+#include <vector>
+
+namespace libcozmo {
+namespace utils {
+
+/// Angles, sines and cosines of discretized headings
+///
+/// Bin i of a table with N bins is the heading i * 2pi / N. Tables are
+/// immutable and shared: get() builds the table for a bin count once and
+/// hands the same instance to every caller, so heading trigonometry is
+/// evaluated once per bin instead of on every edge.
+class HeadingTable {
+ public:
+    /// Gets the shared table for a number of bins
+    ///
+    /// \param num_bins Number of heading bins
+    /// \return The table; thread safe
+    static std::shared_ptr<const HeadingTable> get(const int& num_bins);
+
+    /// Builds a table; prefer get() to share tables
+    ///
+    /// \param num_bins Number of heading bins
+    explicit HeadingTable(const int& num_bins);
+
+    /// Number of heading bins
+    int size() const { return m_num_bins; }
+
+    /// Angle between consecutive bins (radians)
+    double bin_size() const { return m_bin_size; }
+
+    /// Wraps any bin index to [0, size())
+    int wrap(const int& bin) const {
+        const int wrapped = bin % m_num_bins;
+        return wrapped < 0 ? wrapped + m_num_bins : wrapped;
+    }
+
+    /// Heading of a bin in [0, 2pi)
+    double angle(const int& bin) const { return m_angles[wrap(bin)]; }
+
+    /// Heading of a bin in (-pi, pi]
+    double signed_angle(const int& bin) const {
+        return m_signed_angles[wrap(bin)];
+    }
+
+    /// Cosine of the heading of a bin
+    double cos(const int& bin) const { return m_cos[wrap(bin)]; }
+
+    /// Sine of the heading of a bin
+    double sin(const int& bin) const { return m_sin[wrap(bin)]; }
+
+ private:
+    const int m_num_bins;
+    const double m_bin_size;
+    std::vector<double> m_angles;
+    std::vector<double> m_signed_angles;
+    std::vector<double> m_cos;
+    std::vector<double> m_sin;
+};
+
+}  // namespace utils
+}  // namespace libcozmo
+
+#endif  // INCLUDE_UTILS_HEADINGTABLE_HPP_
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_UTILS_THREADPOOL_HPP_
+#define INCLUDE_UTILS_THREADPOOL_HPP_
+
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace libcozmo {
+namespace utils {
+
+/// Fixed size pool of worker threads
+class ThreadPool {
+ public:
+    /// Starts the worker threads
+    ///
+    /// \param num_threads Number of worker threads; if not positive, the
+    /// number of hardware threads is used
+    explicit ThreadPool(const int& num_threads = 0);
+
+    /// Finishes the queued tasks and joins the worker threads
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Queues a task
+    ///
+    /// \param task The task to run on a worker thread
+    /// \return Future that becomes ready when the task finished
+    std::future<void> submit(const std::function<void()>& task);
+
+    /// Runs task(i) for every i in [0, num_tasks) and waits until all calls
+    /// returned. The calling thread runs tasks as well, so this function can
+    /// be called from within a task. If tasks throw, the remaining tasks
+    /// still run and the first exception is rethrown once all of them are
+    /// done
+    ///
+    /// \param num_tasks Number of tasks
+    /// \param task The task to run
+    void parallel_for(
+        const int& num_tasks,
+        const std::function<void(int)>& task);
+
+    /// Gets the number of worker threads
+    int size() const;
+
+ private:
+    /// Runs queued tasks until the pool is destroyed
+    void run();
+
+    std::vector<std::thread> m_threads;
+    std::queue<std::packaged_task<void()>> m_tasks;
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+    bool m_stop;
+};
+
+}  // namespace utils
+}  // namespace libcozmo
+
+#endif  // INCLUDE_UTILS_THREADPOOL_HPP_
@@ -30,6 +30,7 @@
 #ifndef COZMO_UTILS_HPP_
 #define COZMO_UTILS_HPP_
 
+#include <Eigen/Dense>
 #include <vector>
 #include <cmath>
 
@@ -62,6 +63,44 @@ double angle_normalization(T angle) {
     return angle - 2.0 * M_PI * floor(angle / (2.0 * M_PI));
 }
 
+inline double euclidean_distance(
+    const Eigen::Vector2d& a, const Eigen::Vector2d& b) {
+    return (a - b).norm();
+}
+
+inline double euclidean_distance(
+    const Eigen::Vector3d& a, const Eigen::Vector3d& b) {
+    return (a - b).norm();
+}
+
+/// Euclidean distances between the rows of two arrays of points
+///
+/// Each column is a contiguous coordinate, so the sum of squares is
+/// evaluated across rows at SIMD width.
+///
+/// \param a, b Points, one per row
+/// \param[out] distances Distance between each pair of rows
+inline void euclidean_distance(
+    const Eigen::Ref<const Eigen::ArrayXXd>& a,
+    const Eigen::Ref<const Eigen::ArrayXXd>& b,
+    Eigen::ArrayXd* distances) {
+    distances->setZero(a.rows());
+    for (int i = 0; i < a.cols(); ++i) {
+        *distances += (a.col(i) - b.col(i)).square();
+    }
+    *distances = distances->sqrt();
+}
+
+/// Normalizes an array of angles to [0, 2pi)
+///
+/// \param angles Angles in radians
+/// \param[out] normalized Normalized angles
+inline void angle_normalization(
+    const Eigen::Ref<const Eigen::ArrayXd>& angles,
+    Eigen::ArrayXd* normalized) {
+    *normalized = angles - 2.0 * M_PI * (angles / (2.0 * M_PI)).floor();
+}
+
 }  //  namespace utils
 }  //  namespace libcozmo
 
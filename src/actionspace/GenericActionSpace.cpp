@@ -28,6 +28,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <actionspace/GenericActionSpace.hpp>
+#include "utils/HeadingTable.hpp"
 
 namespace libcozmo {
 namespace actionspace {
@@ -36,8 +37,7 @@ GenericActionSpace::GenericActionSpace(
     const std::vector<double>& speeds,
     const std::vector<double>& durations,
     const int& num_headings) {
-    std::vector<double> headings = utils::linspace(
-        0.0, 2.0 * M_PI - 2.0 * M_PI / num_headings, num_headings);
+    const auto headings = utils::HeadingTable::get(num_headings);
     m_actions =
         std::vector<Action*>(
             speeds.size() * durations.size() * num_headings, nullptr);
@@ -48,7 +48,7 @@ GenericActionSpace::GenericActionSpace(
                 const int id =
                     (((j * durations.size()) + k) * num_headings) + l;
                 m_actions[id] =
-                    new Action(speeds[j], durations[k], headings[l]);
+                    new Action(speeds[j], durations[k], headings->angle(l));
             }
         }
     }
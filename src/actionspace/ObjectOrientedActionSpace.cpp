@@ -29,6 +29,7 @@
 
 #include "actionspace/ObjectOrientedActionSpace.hpp"
 #include "statespace/SE2.hpp"
+#include "utils/HeadingTable.hpp"
 #include "utils/utils.hpp"
 
 namespace libcozmo {
@@ -191,6 +192,8 @@ bool ObjectOrientedActionSpace::get_generic_to_object_oriented_action(
     rotation.fromRotationMatrix(transform.rotation());
     const Eigen::Vector2d position = transform.translation();
     const double orientation = rotation.angle();
+    const double cos_orientation = transform.rotation()(0, 0);
+    const double sin_orientation = transform.rotation()(1, 0);
 
     const double heading_offset = generic_action->heading_offset();
     const double max_edge_offset =
@@ -205,15 +208,25 @@ bool ObjectOrientedActionSpace::get_generic_to_object_oriented_action(
         (heading_offset == FRONT || heading_offset == BACK) ? 1 : -1;
     const double heading =
         utils::angle_normalization(orientation + heading_offset);
+    // The sides are quarter turns, so the heading is the object rotation
+    // composed with a rotation read from the table
+    static const std::shared_ptr<const utils::HeadingTable> sides =
+        utils::HeadingTable::get(4);
+    const int side =
+        static_cast<int>(std::round(heading_offset / sides->bin_size()));
+    const double cos_heading =
+        cos_orientation * sides->cos(side) - sin_orientation * sides->sin(side);
+    const double sin_heading =
+        sin_orientation * sides->cos(side) + cos_orientation * sides->sin(side);
 
     *action = CozmoAction(
         generic_action->speed(),
         Eigen::Vector3d(
-            position.x() - center_offset * cos(heading) * clockwise_headings +
-                generic_action->edge_offset() * max_edge_offset * sin(heading) *
+            position.x() - center_offset * cos_heading * clockwise_headings +
+                generic_action->edge_offset() * max_edge_offset * sin_heading *
                 clockwise_headings,
-            position.y() - center_offset * sin(heading) * clockwise_headings -
-                generic_action->edge_offset() * max_edge_offset * cos(heading) *
+            position.y() - center_offset * sin_heading * clockwise_headings -
+                generic_action->edge_offset() * max_edge_offset * cos_heading *
                 clockwise_headings,
             heading));
 
@@ -0,0 +1,210 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "controller/CEMController.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace libcozmo {
+namespace controller {
+
+CEMController::CEMController(
+    const std::shared_ptr<model::Model> model,
+    const actionspace::ActionSpace& actionspace,
+    const CostFunction& cost,
+    const Parameters& parameters,
+    const int& num_threads) :
+    m_engine(model, actionspace, num_threads),
+    m_cost(cost),
+    m_parameters(parameters),
+    m_num_actions(actionspace.size()),
+    m_has_best(false),
+    m_generator(parameters.seed) {
+    if (!m_cost) {
+        throw std::invalid_argument("[CEMController] Null cost given");
+    }
+    if (m_parameters.horizon <= 0 || m_parameters.num_samples <= 0 ||
+        m_parameters.max_iterations <= 0) {
+        throw std::invalid_argument(
+            "[CEMController] Horizon, samples and iterations must be "
+            "positive");
+    }
+    if (m_parameters.num_elites <= 0 ||
+        m_parameters.num_elites > m_parameters.num_samples) {
+        throw std::invalid_argument(
+            "[CEMController] Elites must be in [1, num_samples]");
+    }
+    if (!(m_parameters.smoothing > 0.0 && m_parameters.smoothing <= 1.0)) {
+        throw std::invalid_argument(
+            "[CEMController] Smoothing must be in (0, 1]");
+    }
+    reset();
+}
+
+bool CEMController::solve(const Eigen::VectorXd& state, Solution* solution) {
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsed = [&start]() {
+        return std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+    };
+
+    const int num_samples = m_parameters.num_samples;
+    const int num_elites = m_parameters.num_elites;
+    Eigen::MatrixXi action_ids;
+    Eigen::VectorXd costs;
+    model::Rollouts rollouts;
+    std::vector<int> order(num_samples);
+    Eigen::MatrixXd frequencies(m_parameters.horizon, m_num_actions);
+
+    double best_cost = std::numeric_limits<double>::infinity();
+    int iteration = 0;
+    for (; iteration < m_parameters.max_iterations; ++iteration) {
+        // Stop if the next iteration, taking as long as the average one so
+        // far, would exceed the budget
+        if (iteration > 0 && m_parameters.time_budget > 0.0 &&
+            elapsed() * (iteration + 1) / iteration >
+                m_parameters.time_budget) {
+            break;
+        }
+
+        sample(&action_ids);
+        if (!m_engine.rollout(state, action_ids, &rollouts)) {
+            return false;
+        }
+        m_cost(rollouts, action_ids, &costs);
+        if (costs.size() != num_samples) {
+            return false;
+        }
+
+        std::iota(order.begin(), order.end(), 0);
+        std::partial_sort(
+            order.begin(), order.begin() + num_elites, order.end(),
+            [&costs](int a, int b) { return costs[a] < costs[b]; });
+        if (costs[order[0]] < best_cost) {
+            best_cost = costs[order[0]];
+            m_best = action_ids.row(order[0]).transpose();
+            m_has_best = true;
+        }
+
+        frequencies.setZero();
+        for (int e = 0; e < num_elites; ++e) {
+            for (int t = 0; t < m_parameters.horizon; ++t) {
+                frequencies(t, action_ids(order[e], t)) += 1.0 / num_elites;
+            }
+        }
+        m_distribution = (1.0 - m_parameters.smoothing) * m_distribution +
+            m_parameters.smoothing * frequencies;
+    }
+
+    if (!std::isfinite(best_cost)) {
+        return false;
+    }
+    solution->action_ids = m_best;
+    solution->cost = best_cost;
+    solution->num_iterations = iteration;
+    solution->seconds = elapsed();
+    return true;
+}
+
+void CEMController::shift() {
+    const int horizon = m_parameters.horizon;
+    if (horizon > 1) {
+        const Eigen::MatrixXd tail =
+            m_distribution.bottomRows(horizon - 1);
+        m_distribution.topRows(horizon - 1) = tail;
+        const Eigen::VectorXi best_tail = m_best.tail(horizon - 1);
+        m_best.head(horizon - 1) = best_tail;
+    }
+    m_distribution.row(horizon - 1).setConstant(1.0 / m_num_actions);
+}
+
+void CEMController::reset() {
+    m_distribution = Eigen::MatrixXd::Constant(
+        m_parameters.horizon, m_num_actions, 1.0 / m_num_actions);
+    m_best = Eigen::VectorXi::Zero(m_parameters.horizon);
+    m_has_best = false;
+}
+
+const Eigen::MatrixXd& CEMController::distribution() const {
+    return m_distribution;
+}
+
+CEMController::CostFunction CEMController::goal_cost(
+    const Eigen::Vector3d& goal,
+    const double& translation_weight,
+    const double& rotation_weight) {
+    return [goal, translation_weight, rotation_weight](
+        const model::Rollouts& rollouts,
+        const Eigen::MatrixXi&,
+        Eigen::VectorXd* costs) {
+        costs->setZero(rollouts.num_sequences);
+        for (int t = 1; t <= rollouts.horizon; ++t) {
+            const auto states = rollouts.timestep(t);
+            const Eigen::ArrayXd dx = states.col(0).array() - goal[0];
+            const Eigen::ArrayXd dy = states.col(1).array() - goal[1];
+            Eigen::ArrayXd dtheta = states.col(2).array() - goal[2];
+            dtheta -= 2.0 * M_PI * ((dtheta + M_PI) / (2.0 * M_PI)).floor();
+            costs->array() +=
+                translation_weight * (dx.square() + dy.square()).sqrt() +
+                rotation_weight * dtheta.abs();
+        }
+    };
+}
+
+void CEMController::sample(Eigen::MatrixXi* action_ids) {
+    const int horizon = m_parameters.horizon;
+    action_ids->resize(m_parameters.num_samples, horizon);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<double> cdf(m_num_actions);
+
+    for (int t = 0; t < horizon; ++t) {
+        double total = 0.0;
+        for (int a = 0; a < m_num_actions; ++a) {
+            total += m_distribution(t, a);
+            cdf[a] = total;
+        }
+        for (int k = 0; k < m_parameters.num_samples; ++k) {
+            const double u = uniform(m_generator) * total;
+            const int id = std::upper_bound(cdf.begin(), cdf.end(), u) -
+                cdf.begin();
+            (*action_ids)(k, t) = std::min(id, m_num_actions - 1);
+        }
+    }
+    if (m_has_best) {
+        action_ids->row(0) = m_best.transpose();
+    }
+}
+
+}  // namespace controller
+}  // namespace libcozmo
@@ -27,6 +27,7 @@
 // POSSIBILITY OF SUCH DAMAGE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <cmath>
 #include "distance/SE2.hpp"
 
 namespace libcozmo {
@@ -39,11 +40,70 @@ namespace distance {
         }
     }
 
+    SE2::SE2(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const std::shared_ptr<const DistanceTable> table)
+        : m_statespace(statespace), m_table(table) {
+        if (m_statespace == nullptr) {
+            throw std::invalid_argument("statespace is a nullptr.");
+        }
+        if (m_table == nullptr) {
+            throw std::invalid_argument("table is a nullptr.");
+        }
+        if (m_table->get_resolution() != m_statespace->get_resolution() ||
+            m_table->get_num_theta_vals() !=
+                m_statespace->get_num_theta_vals()) {
+            throw std::invalid_argument(
+                "table does not match the statespace.");
+        }
+    }
+
     double SE2::get_distance(
         const statespace::StateSpace::State& _state_1,
         const statespace::StateSpace::State& _state_2) const {
+        if (m_table) {
+            return m_table->get_distance(
+                static_cast<const statespace::SE2::State&>(_state_1),
+                static_cast<const statespace::SE2::State&>(_state_2));
+        }
         return m_statespace->get_distance(_state_1, _state_2);
     }
 
+    void SE2::get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const {
+        if (_states.cols() != 3) {
+            throw std::invalid_argument("states must have 3 columns.");
+        }
+        const statespace::SE2::State& state =
+            static_cast<const statespace::SE2::State&>(_state);
+        if (m_table) {
+            _distances->resize(_states.rows());
+            for (int i = 0; i < _states.rows(); ++i) {
+                (*_distances)(i) = m_table->get_distance(
+                    _states(i, 0) - state.X(),
+                    _states(i, 1) - state.Y(),
+                    _states(i, 2) - state.Theta());
+            }
+            return;
+        }
+        const double resolution = m_statespace->get_resolution();
+        const int num_theta_vals = m_statespace->get_num_theta_vals();
+        const Eigen::ArrayXd dx =
+            (_states.col(0).array() - state.X()).cast<double>();
+        const Eigen::ArrayXd dy =
+            (_states.col(1).array() - state.Y()).cast<double>();
+        // Shortest angular difference in bins, in [0, num_theta_vals / 2]
+        Eigen::ArrayXi dtheta =
+            (_states.col(2).array() - state.Theta()).unaryExpr(
+                [num_theta_vals](const int& d) { return d % num_theta_vals; });
+        dtheta += (dtheta < 0).cast<int>() * num_theta_vals;
+        const Eigen::ArrayXd angle = (2.0 * M_PI / num_theta_vals) *
+            dtheta.min(num_theta_vals - dtheta).cast<double>();
+        *_distances = (resolution * resolution *
+            (dx.square() + dy.square()) + angle.square()).sqrt().matrix();
+    }
+
 }  // namespace distance
 }  // namespace libcozmo
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "distance/distance_table.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+    DistanceTable::DistanceTable(
+        const std::shared_ptr<statespace::SE2> statespace, const int& radius)
+        : m_resolution(statespace ? statespace->get_resolution() : 0),
+          m_num_theta_vals(statespace ? statespace->get_num_theta_vals() : 0),
+          m_radius(radius) {
+        if (statespace == nullptr) {
+            throw std::invalid_argument("statespace is a nullptr.");
+        }
+        if (m_radius < 0) {
+            throw std::invalid_argument("radius must be non-negative.");
+        }
+        const int size = m_radius + 1;
+        m_table.resize(size * size * m_num_theta_vals);
+        for (int dx = 0; dx < size; ++dx) {
+            for (int dy = 0; dy < size; ++dy) {
+                double* row = &m_table[(dx * size + dy) * m_num_theta_vals];
+                for (int dtheta = 0; dtheta < m_num_theta_vals; ++dtheta) {
+                    row[dtheta] = compute_distance(dx, dy, dtheta);
+                }
+            }
+        }
+    }
+
+    double DistanceTable::get_distance(
+        const int& dx, const int& dy, const int& dtheta) const {
+        const int abs_dx = std::abs(dx);
+        const int abs_dy = std::abs(dy);
+        if (abs_dx > m_radius || abs_dy > m_radius) {
+            return compute_distance(dx, dy, dtheta);
+        }
+        return m_table[
+            (abs_dx * (m_radius + 1) + abs_dy) * m_num_theta_vals +
+            wrap_theta(dtheta)];
+    }
+
+    double DistanceTable::get_distance(
+        const statespace::SE2::State& _state_1,
+        const statespace::SE2::State& _state_2) const {
+        return get_distance(
+            _state_2.X() - _state_1.X(),
+            _state_2.Y() - _state_1.Y(),
+            _state_2.Theta() - _state_1.Theta());
+    }
+
+    double DistanceTable::compute_distance(
+        const int& dx, const int& dy, const int& dtheta) const {
+        const int wrapped = wrap_theta(dtheta);
+        const double angle = (2.0 * M_PI / m_num_theta_vals) *
+            std::min(wrapped, m_num_theta_vals - wrapped);
+        const double x = dx * m_resolution;
+        const double y = dy * m_resolution;
+        return std::sqrt(x * x + y * y + angle * angle);
+    }
+
+    bool DistanceTable::contains(const int& dx, const int& dy) const {
+        return std::abs(dx) <= m_radius && std::abs(dy) <= m_radius;
+    }
+
+    int DistanceTable::get_radius() const { return m_radius; }
+
+    double DistanceTable::get_resolution() const { return m_resolution; }
+
+    int DistanceTable::get_num_theta_vals() const { return m_num_theta_vals; }
+
+    int DistanceTable::wrap_theta(const int& dtheta) const {
+        const int wrapped = dtheta % m_num_theta_vals;
+        return wrapped < 0 ? wrapped + m_num_theta_vals : wrapped;
+    }
+
+}  // namespace distance
+}  // namespace libcozmo
@@ -0,0 +1,132 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "distance/dubins.hpp"
+
+namespace libcozmo {
+namespace distance {
+namespace {
+
+/// Wraps an angle to [0, 2pi), snapping round-off around 0 to 0 so that
+/// a segment of zero length is not turned into a full circle
+double mod2pi(const double& angle) {
+    const double wrapped =
+        angle - 2.0 * M_PI * std::floor(angle / (2.0 * M_PI));
+    return 2.0 * M_PI - wrapped < 1e-9 ? 0.0 : wrapped;
+}
+
+}  // namespace
+
+    Dubins::Dubins(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const double& turning_radius,
+        const int& table_radius)
+        : Nonholonomic(
+            statespace, turning_radius, table_radius, &Dubins::path_length) {}
+
+    double Dubins::path_length(double x, double y, double phi) {
+        // Shkel and Lumelsky, "Classification of the Dubins set", 2001
+        const double d = std::sqrt(x * x + y * y);
+        const double theta = std::atan2(y, x);
+        const double alpha = mod2pi(-theta);
+        const double beta = mod2pi(phi - theta);
+        if (d < 1e-9 && std::abs(mod2pi(alpha - beta + M_PI) - M_PI) < 1e-9) {
+            return 0.0;
+        }
+        const double ca = std::cos(alpha);
+        const double sa = std::sin(alpha);
+        const double cb = std::cos(beta);
+        const double sb = std::sin(beta);
+        const double cab = ca * cb + sa * sb;
+        double length = std::numeric_limits<double>::infinity();
+
+        // LSL and RSR, the straight segment joins the centers of the arcs;
+        // when they coincide the path is a single arc
+        double cx = d + sa - sb;
+        double cy = cb - ca;
+        double p = std::sqrt(cx * cx + cy * cy);
+        if (p < 1e-9) {
+            length = std::min(length, mod2pi(beta - alpha));
+        } else {
+            const double angle = std::atan2(cy, cx);
+            length = std::min(length,
+                mod2pi(angle - alpha) + p + mod2pi(beta - angle));
+        }
+        cx = d - sa + sb;
+        cy = ca - cb;
+        p = std::sqrt(cx * cx + cy * cy);
+        if (p < 1e-9) {
+            length = std::min(length, mod2pi(alpha - beta));
+        } else {
+            const double angle = std::atan2(cy, cx);
+            length = std::min(length,
+                mod2pi(alpha - angle) + p + mod2pi(angle - beta));
+        }
+        // RSL
+        double tmp = d * d - 2.0 + 2.0 * (cab - d * (sa + sb));
+        if (tmp >= 0) {
+            p = std::sqrt(tmp);
+            const double angle =
+                std::atan2(ca + cb, d - sa - sb) - std::atan2(2.0, p);
+            length = std::min(length,
+                mod2pi(alpha - angle) + p + mod2pi(beta - angle));
+        }
+        // LSR
+        tmp = -2.0 + d * d + 2.0 * (cab + d * (sa + sb));
+        if (tmp >= 0) {
+            p = std::sqrt(tmp);
+            const double angle =
+                std::atan2(-ca - cb, d + sa + sb) - std::atan2(-2.0, p);
+            length = std::min(length,
+                mod2pi(angle - alpha) + p + mod2pi(angle - beta));
+        }
+        // RLR
+        tmp = 0.125 * (6.0 - d * d + 2.0 * (cab + d * (sa - sb)));
+        if (std::abs(tmp) <= 1.0) {
+            p = 2.0 * M_PI - std::acos(tmp);
+            const double angle = std::atan2(ca - cb, d - sa + sb);
+            const double t = mod2pi(alpha - angle + 0.5 * p);
+            length = std::min(length, t + p + mod2pi(alpha - beta - t + p));
+        }
+        // LRL
+        tmp = 0.125 * (6.0 - d * d + 2.0 * (cab - d * (sa - sb)));
+        if (std::abs(tmp) <= 1.0) {
+            p = 2.0 * M_PI - std::acos(tmp);
+            const double angle = std::atan2(cb - ca, d + sa - sb);
+            const double t = mod2pi(angle - alpha + 0.5 * p);
+            length = std::min(length, t + p + mod2pi(beta - alpha - t + p));
+        }
+        return length;
+    }
+
+}  // namespace distance
+}  // namespace libcozmo
@@ -0,0 +1,255 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "distance/grid_heuristic.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+    namespace {
+
+    const double kInfinity = std::numeric_limits<double>::infinity();
+
+    }  // namespace
+
+    GridHeuristic::GridHeuristic(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const int& min_x,
+        const int& min_y,
+        const int& max_x,
+        const int& max_y)
+        : m_statespace(statespace),
+          m_min_x(min_x),
+          m_min_y(min_y),
+          m_width(max_x - min_x + 1),
+          m_height(max_y - min_y + 1),
+          m_resolution(statespace ? statespace->get_resolution() : 0),
+          m_goal(-1),
+          m_num_updated_cells(0) {
+        if (m_statespace == nullptr) {
+            throw std::invalid_argument("statespace is a nullptr.");
+        }
+        if (m_width <= 0 || m_height <= 0) {
+            throw std::invalid_argument("workspace bounds are empty.");
+        }
+        m_occupied.assign(m_width * m_height, false);
+        m_g.assign(m_width * m_height, kInfinity);
+        m_rhs.assign(m_width * m_height, kInfinity);
+    }
+
+    double GridHeuristic::get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2) const {
+        const statespace::SE2::State& state_1 =
+            static_cast<const statespace::SE2::State&>(_state_1);
+        const statespace::SE2::State& state_2 =
+            static_cast<const statespace::SE2::State&>(_state_2);
+        if (is_goal(state_2)) {
+            return get_cost_to_goal(state_1.X(), state_1.Y());
+        }
+        if (is_goal(state_1)) {
+            return get_cost_to_goal(state_2.X(), state_2.Y());
+        }
+        return m_resolution * std::hypot(
+            state_1.X() - state_2.X(), state_1.Y() - state_2.Y());
+    }
+
+    void GridHeuristic::get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const {
+        if (_states.cols() != 3) {
+            throw std::invalid_argument("states must have 3 columns.");
+        }
+        const statespace::SE2::State& state =
+            static_cast<const statespace::SE2::State&>(_state);
+        _distances->resize(_states.rows());
+        if (is_goal(state)) {
+            for (int i = 0; i < _states.rows(); ++i) {
+                (*_distances)[i] = get_cost_to_goal(
+                    _states(i, 0), _states(i, 1));
+            }
+            return;
+        }
+        for (int i = 0; i < _states.rows(); ++i) {
+            const statespace::SE2::State other(
+                _states(i, 0), _states(i, 1), _states(i, 2));
+            (*_distances)[i] = get_distance(state, other);
+        }
+    }
+
+    bool GridHeuristic::set_goal(const statespace::SE2::State& goal) {
+        const int cell = index(goal.X(), goal.Y());
+        if (cell < 0) {
+            return false;
+        }
+        std::fill(m_g.begin(), m_g.end(), kInfinity);
+        std::fill(m_rhs.begin(), m_rhs.end(), kInfinity);
+        m_open.clear();
+        m_goal = cell;
+        m_num_updated_cells = 0;
+        update_cell(m_goal);
+        propagate();
+        return true;
+    }
+
+    bool GridHeuristic::set_occupied(
+        const int& x, const int& y, const bool& occupied) {
+        const int cell = index(x, y);
+        if (cell < 0) {
+            return false;
+        }
+        if (m_occupied[cell] == occupied) {
+            return true;
+        }
+        m_occupied[cell] = occupied;
+        if (m_goal < 0) {
+            return true;
+        }
+        // The cell also gates the diagonal steps between its neighbors
+        m_num_updated_cells = 0;
+        update_cell(cell);
+        for_each_neighbor(cell, [this](const int& neighbor, const double&) {
+            update_cell(neighbor);
+        });
+        propagate();
+        return true;
+    }
+
+    bool GridHeuristic::is_occupied(const int& x, const int& y) const {
+        const int cell = index(x, y);
+        return cell < 0 || m_occupied[cell];
+    }
+
+    double GridHeuristic::get_cost_to_goal(const int& x, const int& y) const {
+        const int cell = index(x, y);
+        return cell < 0 ? kInfinity : m_g[cell];
+    }
+
+    int GridHeuristic::get_num_updated_cells() const {
+        return m_num_updated_cells;
+    }
+
+    int GridHeuristic::index(const int& x, const int& y) const {
+        const int column = x - m_min_x;
+        const int row = y - m_min_y;
+        if (column < 0 || column >= m_width || row < 0 || row >= m_height) {
+            return -1;
+        }
+        return row * m_width + column;
+    }
+
+    bool GridHeuristic::is_goal(const statespace::SE2::State& state) const {
+        return m_goal >= 0 && index(state.X(), state.Y()) == m_goal;
+    }
+
+    void GridHeuristic::update_cell(const int& cell) {
+        if (cell != m_goal) {
+            double rhs = kInfinity;
+            if (!m_occupied[cell]) {
+                for_each_neighbor(cell,
+                    [this, &rhs](const int& neighbor, const double& cost) {
+                        rhs = std::min(rhs, m_g[neighbor] + cost);
+                    });
+            }
+            m_rhs[cell] = rhs;
+        } else {
+            m_rhs[cell] = m_occupied[cell] ? kInfinity : 0.0;
+        }
+        if (m_g[cell] != m_rhs[cell]) {
+            m_open.push(cell, std::min(m_g[cell], m_rhs[cell]));
+        } else {
+            m_open.erase(cell);
+        }
+    }
+
+    void GridHeuristic::propagate() {
+        while (!m_open.empty()) {
+            const int cell = m_open.pop();
+            ++m_num_updated_cells;
+            if (m_g[cell] > m_rhs[cell]) {
+                m_g[cell] = m_rhs[cell];
+            } else {
+                m_g[cell] = kInfinity;
+                update_cell(cell);
+            }
+            for_each_neighbor(cell,
+                [this](const int& neighbor, const double&) {
+                    update_cell(neighbor);
+                });
+        }
+    }
+
+    template <typename Function>
+    void GridHeuristic::for_each_neighbor(
+        const int& cell, Function function) const {
+        const int column = cell % m_width;
+        const int row = cell / m_width;
+        const bool left = column > 0;
+        const bool right = column + 1 < m_width;
+        const bool down = row > 0;
+        const bool up = row + 1 < m_height;
+        // A diagonal step needs both cells it passes by to be free
+        const bool left_free = left && !m_occupied[cell - 1];
+        const bool right_free = right && !m_occupied[cell + 1];
+        const bool down_free = down && !m_occupied[cell - m_width];
+        const bool up_free = up && !m_occupied[cell + m_width];
+        const double diagonal = std::sqrt(2.0) * m_resolution;
+        if (left) {
+            function(cell - 1, m_resolution);
+        }
+        if (right) {
+            function(cell + 1, m_resolution);
+        }
+        if (down) {
+            function(cell - m_width, m_resolution);
+        }
+        if (up) {
+            function(cell + m_width, m_resolution);
+        }
+        if (left_free && down_free) {
+            function(cell - m_width - 1, diagonal);
+        }
+        if (right_free && down_free) {
+            function(cell - m_width + 1, diagonal);
+        }
+        if (left_free && up_free) {
+            function(cell + m_width - 1, diagonal);
+        }
+        if (right_free && up_free) {
+            function(cell + m_width + 1, diagonal);
+        }
+    }
+
+}  // namespace distance
+}  // namespace libcozmo
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include "distance/heading.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+    Heading::Heading(const std::shared_ptr<statespace::SE2> statespace)
+        : m_statespace(statespace),
+          m_num_theta_vals(statespace ? statespace->get_num_theta_vals() : 0),
+          m_bin_size(statespace ? 2.0 * M_PI / m_num_theta_vals : 0) {
+        if (m_statespace == nullptr) {
+            throw std::invalid_argument("statespace is a nullptr.");
+        }
+    }
+
+    double Heading::get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2) const {
+        const statespace::SE2::State& state_1 =
+            static_cast<const statespace::SE2::State&>(_state_1);
+        const statespace::SE2::State& state_2 =
+            static_cast<const statespace::SE2::State&>(_state_2);
+        return m_bin_size *
+            get_bin_distance(state_1.Theta(), state_2.Theta());
+    }
+
+    void Heading::get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const {
+        if (_states.cols() != 3) {
+            throw std::invalid_argument("states must have 3 columns.");
+        }
+        const statespace::SE2::State& state =
+            static_cast<const statespace::SE2::State&>(_state);
+        // Bin differences wrapped to [0, N) then folded to [0, N / 2]
+        Eigen::ArrayXi difference =
+            (_states.col(2).array() - state.Theta()).unaryExpr(
+                [this](const int& d) { return d % m_num_theta_vals; });
+        difference += (difference < 0).cast<int>() * m_num_theta_vals;
+        *_distances = (m_bin_size * difference.min(
+            m_num_theta_vals - difference).cast<double>()).matrix();
+    }
+
+    int Heading::get_bin_distance(
+        const int& theta_1, const int& theta_2) const {
+        int difference = (theta_1 - theta_2) % m_num_theta_vals;
+        if (difference < 0) {
+            difference += m_num_theta_vals;
+        }
+        return std::min(difference, m_num_theta_vals - difference);
+    }
+
+}  // namespace distance
+}  // namespace libcozmo
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include "distance/nonholonomic.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+    Nonholonomic::Nonholonomic(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const double& turning_radius,
+        const int& table_radius,
+        PathLength path_length)
+        : m_statespace(statespace),
+          m_turning_radius(turning_radius),
+          m_table_radius(table_radius),
+          m_path_length(path_length),
+          m_resolution(statespace ? statespace->get_resolution() : 0),
+          m_num_theta_vals(statespace ? statespace->get_num_theta_vals() : 0),
+          m_headings(statespace ?
+              utils::HeadingTable::get(m_num_theta_vals) : nullptr) {
+        if (m_statespace == nullptr) {
+            throw std::invalid_argument("statespace is a nullptr.");
+        }
+        if (m_turning_radius <= 0) {
+            throw std::invalid_argument("turning radius must be positive.");
+        }
+        if (m_table_radius < 0) {
+            throw std::invalid_argument("table radius must be non-negative.");
+        }
+        const int width = 2 * m_table_radius + 1;
+        m_table.resize(width * width * m_num_theta_vals * m_num_theta_vals);
+        auto entry = m_table.begin();
+        for (int dx = -m_table_radius; dx <= m_table_radius; ++dx) {
+            for (int dy = -m_table_radius; dy <= m_table_radius; ++dy) {
+                for (int i = 0; i < m_num_theta_vals; ++i) {
+                    for (int j = 0; j < m_num_theta_vals; ++j) {
+                        *entry++ = compute_distance(dx, dy, i, j);
+                    }
+                }
+            }
+        }
+    }
+
+    double Nonholonomic::get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2) const {
+        const statespace::SE2::State& state_1 =
+            static_cast<const statespace::SE2::State&>(_state_1);
+        const statespace::SE2::State& state_2 =
+            static_cast<const statespace::SE2::State&>(_state_2);
+        const int dx = state_2.X() - state_1.X();
+        const int dy = state_2.Y() - state_1.Y();
+        const int theta_1 = wrap_theta(state_1.Theta());
+        const int theta_2 = wrap_theta(state_2.Theta());
+        if (std::abs(dx) > m_table_radius || std::abs(dy) > m_table_radius) {
+            return compute_distance(dx, dy, theta_1, theta_2);
+        }
+        const int width = 2 * m_table_radius + 1;
+        const int cell = (dx + m_table_radius) * width + dy + m_table_radius;
+        return m_table[
+            (cell * m_num_theta_vals + theta_1) * m_num_theta_vals + theta_2];
+    }
+
+    void Nonholonomic::get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const {
+        if (_states.cols() != 3) {
+            throw std::invalid_argument("states must have 3 columns.");
+        }
+        _distances->resize(_states.rows());
+        for (int i = 0; i < _states.rows(); ++i) {
+            (*_distances)(i) = get_distance(
+                _state,
+                statespace::SE2::State(
+                    _states(i, 0), _states(i, 1), _states(i, 2)));
+        }
+    }
+
+    double Nonholonomic::compute_distance(
+        const statespace::SE2::State& _state_1,
+        const statespace::SE2::State& _state_2) const {
+        return compute_distance(
+            _state_2.X() - _state_1.X(),
+            _state_2.Y() - _state_1.Y(),
+            wrap_theta(_state_1.Theta()),
+            wrap_theta(_state_2.Theta()));
+    }
+
+    double Nonholonomic::get_turning_radius() const {
+        return m_turning_radius;
+    }
+
+    int Nonholonomic::get_table_radius() const { return m_table_radius; }
+
+    double Nonholonomic::compute_distance(
+        const int& dx,
+        const int& dy,
+        const int& theta_1,
+        const int& theta_2) const {
+        const double cos_heading = m_headings->cos(theta_1);
+        const double sin_heading = m_headings->sin(theta_1);
+        // Goal position in the start frame, scaled to a unit turning radius
+        const double scale = m_resolution / m_turning_radius;
+        const double x = (cos_heading * dx + sin_heading * dy) * scale;
+        const double y = (-sin_heading * dx + cos_heading * dy) * scale;
+        const double phi = (theta_2 - theta_1) * m_headings->bin_size();
+        return m_turning_radius * m_path_length(x, y, phi);
+    }
+
+    int Nonholonomic::wrap_theta(const int& theta) const {
+        const int wrapped = theta % m_num_theta_vals;
+        return wrapped < 0 ? wrapped + m_num_theta_vals : wrapped;
+    }
+
+}  // namespace distance
+}  // namespace libcozmo
@@ -36,7 +36,9 @@ namespace libcozmo {
 namespace distance {
 
     Orientation::Orientation(const std::shared_ptr<statespace::SE2> statespace)
-        : m_statespace(statespace) {
+        : m_statespace(statespace),
+          m_headings(statespace ? utils::HeadingTable::get(
+              statespace->get_num_theta_vals()) : nullptr) {
         if (m_statespace == nullptr) {
             throw std::invalid_argument("statespace is a nullptr.");
         }
@@ -45,20 +47,37 @@ namespace distance {
     double Orientation::get_distance(
         const libcozmo::statespace::StateSpace::State& _state_1,
         const libcozmo::statespace::StateSpace::State& _state_2) const {
-        aikido::statespace::SE2::State continuous_state_1;
-        m_statespace->
-            discrete_state_to_continuous(_state_1, &continuous_state_1);
-        aikido::statespace::SE2::State continuous_state_2;
-        m_statespace->
-            discrete_state_to_continuous(_state_2, &continuous_state_2);
-        Eigen::Rotation2Dd rotation_1 = Eigen::Rotation2Dd::Identity();
-        Eigen::Rotation2Dd rotation_2 = Eigen::Rotation2Dd::Identity();
-        rotation_1.fromRotationMatrix(
-            continuous_state_1.getIsometry().rotation());
-        rotation_2.fromRotationMatrix(
-            continuous_state_2.getIsometry().rotation());
-        return utils::angle_normalization(
-            std::abs(rotation_1.angle() - rotation_2.angle()));
+        const statespace::SE2::State& state_1 =
+            static_cast<const statespace::SE2::State&>(_state_1);
+        const statespace::SE2::State& state_2 =
+            static_cast<const statespace::SE2::State&>(_state_2);
+        return utils::angle_normalization(std::abs(
+            m_headings->signed_angle(state_1.Theta()) -
+            m_headings->signed_angle(state_2.Theta())));
+    }
+
+    void Orientation::get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const {
+        if (_states.cols() != 3) {
+            throw std::invalid_argument("states must have 3 columns.");
+        }
+        const statespace::SE2::State& state =
+            static_cast<const statespace::SE2::State&>(_state);
+        const int num_theta_vals = m_statespace->get_num_theta_vals();
+        const double bin_size = 2.0 * M_PI / num_theta_vals;
+        // Bins are wrapped to [0, N) as in get_distance(); bins above half a
+        // turn are signed angles in (-pi, pi]
+        const int half = num_theta_vals / 2;
+        const int query = m_headings->wrap(state.Theta());
+        const int wrapped = query > half ? query - num_theta_vals : query;
+        const Eigen::ArrayXi theta = _states.col(2).array().unaryExpr(
+            [this](const int& bin) { return m_headings->wrap(bin); });
+        const Eigen::ArrayXi others =
+            theta - (theta > half).cast<int>() * num_theta_vals;
+        *_distances =
+            (bin_size * (others - wrapped).abs().cast<double>()).matrix();
     }
 
 }  // namespace distance
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "distance/reeds_shepp.hpp"
+
+namespace libcozmo {
+namespace distance {
+namespace {
+
+// Formulas follow Reeds and Shepp, "Optimal paths for a car that goes both
+// forwards and backwards", 1990, numbered as in section 8 of the paper.
+// Every word is evaluated for the goal and its time-flipped and reflected
+// images, which have the same length.
+
+const double kZero = -1e-9;
+
+/// Wraps an angle to (-pi, pi]
+double mod2pi(const double& angle) {
+    return angle - 2.0 * M_PI * std::ceil((angle - M_PI) / (2.0 * M_PI));
+}
+
+void polar(const double& x, const double& y, double* r, double* theta) {
+    *r = std::sqrt(x * x + y * y);
+    *theta = std::atan2(y, x);
+}
+
+void tau_omega(
+    const double& u, const double& v, const double& xi, const double& eta,
+    const double& phi, double* tau, double* omega) {
+    const double delta = mod2pi(u - v);
+    const double a = std::sin(u) - std::sin(delta);
+    const double b = std::cos(u) - std::cos(delta) - 1.0;
+    const double t1 = std::atan2(eta * a - xi * b, xi * a + eta * b);
+    const double t2 =
+        2.0 * (std::cos(delta) - std::cos(v) - std::cos(u)) + 3.0;
+    *tau = t2 < 0 ? mod2pi(t1 + M_PI) : mod2pi(t1);
+    *omega = mod2pi(*tau - u + v - phi);
+}
+
+/// Length of a word, or infinity if it does not reach the goal
+typedef double (*Word)(double x, double y, double phi);
+
+// 8.1
+double LpSpLp(double x, double y, double phi) {
+    double u, t;
+    polar(x - std::sin(phi), y - 1.0 + std::cos(phi), &u, &t);
+    if (u < 1e-9) {
+        // The arcs share their center, so the direction is arbitrary
+        t = 0.0;
+    }
+    if (t >= kZero) {
+        const double v = mod2pi(phi - t);
+        if (v >= kZero) {
+            return t + u + v;
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+// 8.2
+double LpSpRp(double x, double y, double phi) {
+    double u1, t1;
+    polar(x + std::sin(phi), y - 1.0 - std::cos(phi), &u1, &t1);
+    u1 = u1 * u1;
+    if (u1 >= 4.0) {
+        const double u = std::sqrt(u1 - 4.0);
+        const double t = mod2pi(t1 + std::atan2(2.0, u));
+        const double v = mod2pi(t - phi);
+        if (t >= kZero && v >= kZero) {
+            return t + u + v;
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+// 8.3
+double LpRmL(double x, double y, double phi) {
+    double u1, theta;
+    polar(x - std::sin(phi), y - 1.0 + std::cos(phi), &u1, &theta);
+    if (u1 <= 4.0) {
+        const double u = -2.0 * std::asin(0.25 * u1);
+        const double t = mod2pi(theta + 0.5 * u + M_PI);
+        const double v = mod2pi(phi - t + u);
+        if (t >= kZero && u <= -kZero) {
+            return std::abs(t) + std::abs(u) + std::abs(v);
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+// 8.7
+double LpRupLumRm(double x, double y, double phi) {
+    const double xi = x + std::sin(phi);
+    const double eta = y - 1.0 - std::cos(phi);
+    const double rho = 0.25 * (2.0 + std::sqrt(xi * xi + eta * eta));
+    if (rho <= 1.0) {
+        const double u = std::acos(rho);
+        double t, v;
+        tau_omega(u, -u, xi, eta, phi, &t, &v);
+        if (t >= kZero && v <= -kZero) {
+            return std::abs(t) + 2.0 * std::abs(u) + std::abs(v);
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+// 8.8
+double LpRumLumRp(double x, double y, double phi) {
+    const double xi = x + std::sin(phi);
+    const double eta = y - 1.0 - std::cos(phi);
+    const double rho = (20.0 - xi * xi - eta * eta) / 16.0;
+    if (rho >= 0 && rho <= 1.0) {
+        const double u = -std::acos(rho);
+        if (u >= -0.5 * M_PI) {
+            double t, v;
+            tau_omega(u, u, xi, eta, phi, &t, &v);
+            if (t >= kZero && v >= kZero) {
+                return std::abs(t) + 2.0 * std::abs(u) + std::abs(v);
+            }
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+// 8.9
+double LpRmSmLm(double x, double y, double phi) {
+    double rho, theta;
+    polar(x - std::sin(phi), y - 1.0 + std::cos(phi), &rho, &theta);
+    if (rho >= 2.0) {
+        const double r = std::sqrt(rho * rho - 4.0);
+        const double u = 2.0 - r;
+        const double t = mod2pi(theta + std::atan2(r, -2.0));
+        const double v = mod2pi(phi - 0.5 * M_PI - t);
+        if (t >= kZero && u <= -kZero && v <= -kZero) {
+            return std::abs(t) + std::abs(u) + std::abs(v) + 0.5 * M_PI;
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+// 8.10
+double LpRmSmRm(double x, double y, double phi) {
+    const double xi = x + std::sin(phi);
+    const double eta = y - 1.0 - std::cos(phi);
+    double rho, theta;
+    polar(-eta, xi, &rho, &theta);
+    if (rho >= 2.0) {
+        const double t = theta;
+        const double u = 2.0 - rho;
+        const double v = mod2pi(t + 0.5 * M_PI - phi);
+        if (t >= kZero && u <= -kZero && v <= -kZero) {
+            return std::abs(t) + std::abs(u) + std::abs(v) + 0.5 * M_PI;
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+// 8.11
+double LpRmSLmRp(double x, double y, double phi) {
+    const double xi = x + std::sin(phi);
+    const double eta = y - 1.0 - std::cos(phi);
+    double rho, theta;
+    polar(xi, eta, &rho, &theta);
+    if (rho >= 2.0) {
+        const double u = 4.0 - std::sqrt(rho * rho - 4.0);
+        if (u <= -kZero) {
+            const double t = mod2pi(std::atan2(
+                (4.0 - u) * xi - 2.0 * eta, -2.0 * xi + (u - 4.0) * eta));
+            const double v = mod2pi(t - phi);
+            if (t >= kZero && v >= kZero) {
+                return std::abs(t) + std::abs(u) + std::abs(v) + M_PI;
+            }
+        }
+    }
+    return std::numeric_limits<double>::infinity();
+}
+
+/// Shortest length of a word over the goal and its symmetric images
+double symmetric_length(Word word, double x, double y, double phi) {
+    return std::min(
+        std::min(word(x, y, phi), word(-x, y, -phi)),
+        std::min(word(x, -y, -phi), word(-x, -y, phi)));
+}
+
+}  // namespace
+
+    ReedsShepp::ReedsShepp(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const double& turning_radius,
+        const int& table_radius)
+        : Nonholonomic(
+            statespace,
+            turning_radius,
+            table_radius,
+            &ReedsShepp::path_length) {}
+
+    double ReedsShepp::path_length(double x, double y, double phi) {
+        phi = mod2pi(phi);
+        // Goal seen from the end of the path, for words driven backwards
+        const double xb = x * std::cos(phi) + y * std::sin(phi);
+        const double yb = x * std::sin(phi) - y * std::cos(phi);
+        double length = std::numeric_limits<double>::infinity();
+        // CSC
+        length = std::min(length, symmetric_length(LpSpLp, x, y, phi));
+        length = std::min(length, symmetric_length(LpSpRp, x, y, phi));
+        // CCC
+        length = std::min(length, symmetric_length(LpRmL, x, y, phi));
+        length = std::min(length, symmetric_length(LpRmL, xb, yb, phi));
+        // CCCC
+        length = std::min(length, symmetric_length(LpRupLumRm, x, y, phi));
+        length = std::min(length, symmetric_length(LpRumLumRp, x, y, phi));
+        // CCSC
+        length = std::min(length, symmetric_length(LpRmSmLm, x, y, phi));
+        length = std::min(length, symmetric_length(LpRmSmRm, x, y, phi));
+        length = std::min(length, symmetric_length(LpRmSmLm, xb, yb, phi));
+        length = std::min(length, symmetric_length(LpRmSmRm, xb, yb, phi));
+        // CCSCC
+        length = std::min(length, symmetric_length(LpRmSLmRp, x, y, phi));
+        return length;
+    }
+
+}  // namespace distance
+}  // namespace libcozmo
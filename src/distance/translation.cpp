@@ -58,5 +58,23 @@ namespace distance {
         return utils::euclidean_distance(position, zeros);
     }
 
+    void Translation::get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const {
+        if (_states.cols() != 3) {
+            throw std::invalid_argument("states must have 3 columns.");
+        }
+        const statespace::SE2::State& state =
+            static_cast<const statespace::SE2::State&>(_state);
+        // Cell offsets are exact integers; the half-cell offsets cancel
+        const Eigen::ArrayXd dx =
+            (_states.col(0).array() - state.X()).cast<double>();
+        const Eigen::ArrayXd dy =
+            (_states.col(1).array() - state.Y()).cast<double>();
+        *_distances = (m_statespace->get_resolution() *
+            (dx.square() + dy.square()).sqrt()).matrix();
+    }
+
 }  // namespace distance
 }  // namespace libcozmo
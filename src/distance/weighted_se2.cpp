@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include "distance/weighted_se2.hpp"
+#include "distance/orientation.hpp"
+#include "utils/utils.hpp"
+
+namespace libcozmo {
+namespace distance {
+
+    WeightedSE2::WeightedSE2(
+        const std::shared_ptr<statespace::SE2> statespace,
+        const double& translation_weight,
+        const double& rotation_weight)
+        : m_statespace(statespace),
+          m_translation_weight(translation_weight),
+          m_rotation_weight(rotation_weight),
+          m_resolution(statespace ? statespace->get_resolution() : 0),
+          m_num_theta_vals(statespace ? statespace->get_num_theta_vals() : 0) {
+        if (m_statespace == nullptr) {
+            throw std::invalid_argument("statespace is a nullptr.");
+        }
+        if (m_translation_weight < 0 || m_rotation_weight < 0) {
+            throw std::invalid_argument("weights must be non-negative.");
+        }
+        // Filled with the component metric so lookups match it exactly
+        const Orientation orientation(m_statespace);
+        m_orientation_table.resize(m_num_theta_vals, m_num_theta_vals);
+        for (int i = 0; i < m_num_theta_vals; ++i) {
+            for (int j = 0; j < m_num_theta_vals; ++j) {
+                m_orientation_table(i, j) = orientation.get_distance(
+                    statespace::SE2::State(0, 0, i),
+                    statespace::SE2::State(0, 0, j));
+            }
+        }
+    }
+
+    double WeightedSE2::get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2) const {
+        const statespace::SE2::State& state_1 =
+            static_cast<const statespace::SE2::State&>(_state_1);
+        const statespace::SE2::State& state_2 =
+            static_cast<const statespace::SE2::State&>(_state_2);
+        // Same arithmetic as the continuous cell centers of Translation
+        const double half = m_resolution / 2.0;
+        const Eigen::Vector2d position(
+            (state_1.X() * m_resolution + half) -
+                (state_2.X() * m_resolution + half),
+            (state_1.Y() * m_resolution + half) -
+                (state_2.Y() * m_resolution + half));
+        const double translation =
+            utils::euclidean_distance(position, Eigen::Vector2d(0, 0));
+        return m_translation_weight * translation + m_rotation_weight *
+            orientation_distance(state_1.Theta(), state_2.Theta());
+    }
+
+    void WeightedSE2::get_distances(
+        const libcozmo::statespace::StateSpace::State& _state,
+        const Eigen::Ref<const Eigen::MatrixXi>& _states,
+        Eigen::VectorXd* _distances) const {
+        if (_states.cols() != 3) {
+            throw std::invalid_argument("states must have 3 columns.");
+        }
+        const statespace::SE2::State& state =
+            static_cast<const statespace::SE2::State&>(_state);
+        const double half = m_resolution / 2.0;
+        const Eigen::ArrayXd dx = (state.X() * m_resolution + half) -
+            (_states.col(0).array().cast<double>() * m_resolution + half);
+        const Eigen::ArrayXd dy = (state.Y() * m_resolution + half) -
+            (_states.col(1).array().cast<double>() * m_resolution + half);
+        Eigen::ArrayXd orientation(_states.rows());
+        for (int i = 0; i < _states.rows(); ++i) {
+            orientation(i) = orientation_distance(state.Theta(), _states(i, 2));
+        }
+        *_distances = (m_translation_weight * (dx.square() + dy.square()).sqrt()
+            + m_rotation_weight * orientation).matrix();
+    }
+
+    double WeightedSE2::get_translation_weight() const {
+        return m_translation_weight;
+    }
+
+    double WeightedSE2::get_rotation_weight() const {
+        return m_rotation_weight;
+    }
+
+    double WeightedSE2::orientation_distance(
+        const int& theta_1, const int& theta_2) const {
+        return m_orientation_table(wrap_theta(theta_1), wrap_theta(theta_2));
+    }
+
+    int WeightedSE2::wrap_theta(const int& theta) const {
+        const int wrapped = theta % m_num_theta_vals;
+        return wrapped < 0 ? wrapped + m_num_theta_vals : wrapped;
+    }
+
+}  // namespace distance
+}  // namespace libcozmo
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/Dataset.hpp"
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace libcozmo {
+namespace model {
+
+constexpr int Dataset::kSampleSize;
+
+Dataset::Dataset(const std::string& dataset_path) {
+    DatasetReader reader(dataset_path);
+    reader.read(std::numeric_limits<int>::max(), this);
+}
+
+Dataset::Dataset(
+    const Eigen::MatrixXd& actions,
+    const Eigen::MatrixXd& start_states,
+    const Eigen::MatrixXd& end_states) :
+    m_actions(actions),
+    m_start_states(start_states),
+    m_end_states(end_states) {
+    if (actions.cols() != 4 || start_states.cols() != 3 ||
+        end_states.cols() != 3) {
+        throw std::invalid_argument("[Dataset] Invalid sample size");
+    }
+    if (actions.rows() != start_states.rows() ||
+        actions.rows() != end_states.rows()) {
+        throw std::invalid_argument("[Dataset] Mismatched number of samples");
+    }
+}
+
+void Dataset::add_sample(
+    const Eigen::VectorXd& action,
+    const Eigen::VectorXd& start_state,
+    const Eigen::VectorXd& end_state) {
+    const int index = size();
+    m_actions.conservativeResize(index + 1, Eigen::NoChange);
+    m_start_states.conservativeResize(index + 1, Eigen::NoChange);
+    m_end_states.conservativeResize(index + 1, Eigen::NoChange);
+    m_actions.row(index) = action.transpose();
+    m_start_states.row(index) = start_state.transpose();
+    m_end_states.row(index) = end_state.transpose();
+}
+
+bool Dataset::parse_line(const std::string& line, Eigen::VectorXd* sample) {
+    const size_t first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#') {
+        return false;
+    }
+
+    sample->resize(kSampleSize);
+    std::stringstream stream(line);
+    std::string value;
+    int i = 0;
+    while (std::getline(stream, value, ',')) {
+        if (i == kSampleSize) {
+            return false;
+        }
+        try {
+            (*sample)[i++] = std::stod(value);
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return i == kSampleSize;
+}
+
+int Dataset::size() const {
+    return m_actions.rows();
+}
+
+const Eigen::MatrixXd& Dataset::actions() const {
+    return m_actions;
+}
+
+const Eigen::MatrixXd& Dataset::start_states() const {
+    return m_start_states;
+}
+
+const Eigen::MatrixXd& Dataset::end_states() const {
+    return m_end_states;
+}
+
+DatasetReader::DatasetReader(const std::string& dataset_path) :
+    m_file(dataset_path),
+    m_line_number(0) {
+    if (!m_file.is_open()) {
+        throw std::invalid_argument("[Dataset] Invalid dataset_path");
+    }
+}
+
+bool DatasetReader::read(const int& max_samples, Dataset* chunk) {
+    std::vector<Eigen::VectorXd> samples;
+    std::string line;
+    Eigen::VectorXd sample;
+    while (static_cast<int>(samples.size()) < max_samples &&
+           std::getline(m_file, line)) {
+        ++m_line_number;
+        const size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+        if (!Dataset::parse_line(line, &sample)) {
+            std::stringstream msg;
+            msg << "[Dataset] Malformed sample on line " << m_line_number;
+            throw std::invalid_argument(msg.str());
+        }
+        samples.push_back(sample);
+    }
+
+    const int num_samples = samples.size();
+    Eigen::MatrixXd actions(num_samples, 4);
+    Eigen::MatrixXd start_states(num_samples, 3);
+    Eigen::MatrixXd end_states(num_samples, 3);
+    for (int i = 0; i < num_samples; ++i) {
+        actions.row(i) = samples[i].segment<4>(0).transpose();
+        start_states.row(i) = samples[i].segment<3>(4).transpose();
+        end_states.row(i) = samples[i].segment<3>(7).transpose();
+    }
+    *chunk = Dataset(actions, start_states, end_states);
+    return num_samples > 0;
+}
+
+}  // namespace model
+}  // namespace libcozmo
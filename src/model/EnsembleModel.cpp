@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/EnsembleModel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <exception>
+#include <functional>
+#include <future>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace model {
+
+EnsembleModel::EnsembleModel(
+    const std::vector<std::shared_ptr<Model>>& members,
+    const MergePolicy& policy,
+    const int& num_threads) :
+    m_members(members),
+    m_policy(policy),
+    m_pool(new utils::ThreadPool(num_threads)),
+    m_statistics(members.size()) {
+    if (m_members.empty()) {
+        throw std::invalid_argument("[EnsembleModel] No members given");
+    }
+    for (const auto& member : m_members) {
+        if (!member) {
+            throw std::invalid_argument("[EnsembleModel] Null member given");
+        }
+    }
+}
+
+bool EnsembleModel::predict_state(
+    const Eigen::VectorXd& input_action,
+    const Eigen::VectorXd& input_state,
+    Eigen::VectorXd* output_state) const {
+    Eigen::MatrixXd output_states;
+    if (!predict_states(
+            input_action.transpose(), input_state.transpose(),
+            &output_states)) {
+        return false;
+    }
+    *output_state = output_states.row(0).transpose();
+    return true;
+}
+
+bool EnsembleModel::predict_states(
+    const Eigen::MatrixXd& input_actions,
+    const Eigen::MatrixXd& input_states,
+    Eigen::MatrixXd* output_states) const {
+    std::vector<Eigen::MatrixXd> means;
+    if (!evaluate_members(input_actions, input_states, &means, nullptr)) {
+        return false;
+    }
+    merge(&means, nullptr, output_states, nullptr);
+    return true;
+}
+
+bool EnsembleModel::predict_distribution(
+    const Eigen::MatrixXd& input_actions,
+    const Eigen::MatrixXd& input_states,
+    Eigen::MatrixXd* output_states,
+    Eigen::MatrixXd* output_variances) const {
+    std::vector<Eigen::MatrixXd> means;
+    std::vector<Eigen::MatrixXd> variances;
+    if (!evaluate_members(input_actions, input_states, &means, &variances)) {
+        return false;
+    }
+    merge(&means, &variances, output_states, output_variances);
+    return true;
+}
+
+bool EnsembleModel::is_thread_safe() const {
+    for (const auto& member : m_members) {
+        if (!member->is_thread_safe()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int EnsembleModel::size() const {
+    return m_members.size();
+}
+
+std::vector<EnsembleModel::MemberStatistics>
+    EnsembleModel::get_statistics() const {
+    std::lock_guard<std::mutex> lock(m_statistics_mutex);
+    return m_statistics;
+}
+
+void EnsembleModel::reset_statistics() {
+    std::lock_guard<std::mutex> lock(m_statistics_mutex);
+    std::fill(m_statistics.begin(), m_statistics.end(), MemberStatistics());
+}
+
+bool EnsembleModel::evaluate_members(
+    const Eigen::MatrixXd& input_actions,
+    const Eigen::MatrixXd& input_states,
+    std::vector<Eigen::MatrixXd>* means,
+    std::vector<Eigen::MatrixXd>* variances) const {
+    if (input_actions.rows() != input_states.rows()) {
+        return false;
+    }
+
+    const int num_members = m_members.size();
+    std::vector<Eigen::MatrixXd> member_means(num_members);
+    std::vector<Eigen::MatrixXd> member_variances(num_members);
+    // Not std::vector<bool>, members write their flag concurrently
+    std::vector<char> success(num_members, 0);
+
+    auto run_member = [&](int i) {
+        const auto start = std::chrono::steady_clock::now();
+        if (variances) {
+            success[i] = m_members[i]->predict_distribution(
+                input_actions, input_states,
+                &member_means[i], &member_variances[i]);
+        } else {
+            success[i] = m_members[i]->predict_states(
+                input_actions, input_states, &member_means[i]);
+        }
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+        std::lock_guard<std::mutex> lock(m_statistics_mutex);
+        MemberStatistics& statistics = m_statistics[i];
+        statistics.num_calls++;
+        statistics.num_failures += success[i] ? 0 : 1;
+        statistics.num_samples += input_actions.rows();
+        statistics.total_seconds += seconds;
+        statistics.max_seconds = std::max(statistics.max_seconds, seconds);
+    };
+
+    // Pool tasks write into the locals above, so all of them have to finish
+    // before this function returns or unwinds, even if a member throws
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_members);
+    std::exception_ptr exception;
+    try {
+        for (int i = 0; i < num_members; ++i) {
+            if (m_members[i]->is_thread_safe()) {
+                futures.push_back(m_pool->submit(std::bind(run_member, i)));
+            }
+        }
+        for (int i = 0; i < num_members; ++i) {
+            if (!m_members[i]->is_thread_safe()) {
+                run_member(i);
+            }
+        }
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    for (auto& future : futures) {
+        future.wait();
+    }
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    means->clear();
+    if (variances) {
+        variances->clear();
+    }
+    for (int i = 0; i < num_members; ++i) {
+        if (!success[i] ||
+            member_means[i].rows() != input_states.rows() ||
+            member_means[i].cols() != input_states.cols()) {
+            continue;
+        }
+        means->push_back(std::move(member_means[i]));
+        if (variances) {
+            variances->push_back(std::move(member_variances[i]));
+        }
+    }
+    return !means->empty();
+}
+
+void EnsembleModel::merge(
+    std::vector<Eigen::MatrixXd>* means,
+    const std::vector<Eigen::MatrixXd>* variances,
+    Eigen::MatrixXd* output_states,
+    Eigen::MatrixXd* output_variances) const {
+    const int num_members = means->size();
+    const int rows = means->front().rows();
+    const int cols = means->front().cols();
+
+    // Unwrap the orientations so that members agreeing up to 2pi average to
+    // the same angle
+    if (cols == 3) {
+        const Eigen::ArrayXd reference = means->front().col(2).array();
+        for (int i = 1; i < num_members; ++i) {
+            Eigen::ArrayXd delta = (*means)[i].col(2).array() - reference;
+            delta -= 2.0 * M_PI * ((delta + M_PI) / (2.0 * M_PI)).floor();
+            (*means)[i].col(2) = (reference + delta).matrix();
+        }
+    }
+
+    Eigen::MatrixXd mean = Eigen::MatrixXd::Zero(rows, cols);
+    for (const auto& member_mean : *means) {
+        mean += member_mean;
+    }
+    mean /= num_members;
+
+    if (output_variances) {
+        output_variances->setZero(rows, cols);
+        for (int i = 0; i < num_members; ++i) {
+            *output_variances +=
+                ((*means)[i] - mean).array().square().matrix();
+            if (variances) {
+                *output_variances += (*variances)[i];
+            }
+        }
+        *output_variances /= num_members;
+    }
+
+    if (m_policy == MergePolicy::MEDIAN) {
+        std::vector<double> votes(num_members);
+        for (int j = 0; j < cols; ++j) {
+            for (int r = 0; r < rows; ++r) {
+                for (int i = 0; i < num_members; ++i) {
+                    votes[i] = (*means)[i](r, j);
+                }
+                const int half = num_members / 2;
+                std::nth_element(
+                    votes.begin(), votes.begin() + half, votes.end());
+                double median = votes[half];
+                if (num_members % 2 == 0) {
+                    median = 0.5 * (median +
+                        *std::max_element(votes.begin(), votes.begin() + half));
+                }
+                mean(r, j) = median;
+            }
+        }
+    }
+
+    if (cols == 3) {
+        Eigen::ArrayXd theta = mean.col(2).array();
+        theta -= 2.0 * M_PI * (theta / (2.0 * M_PI)).floor();
+        mean.col(2) = theta.matrix();
+    }
+    *output_states = std::move(mean);
+}
+
+}  // namespace model
+}  // namespace libcozmo
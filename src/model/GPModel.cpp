@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/GPModel.hpp"
+#include <cmath>
+#include "utils/utils.hpp"
+
+namespace libcozmo {
+namespace model {
+
+constexpr int GPModel::kInputSize;
+constexpr int GPModel::kOutputSize;
+
+bool GPModel::predict_state(
+    const Eigen::VectorXd& input_action,
+    const Eigen::VectorXd& input_state,
+    Eigen::VectorXd* output_state) const {
+    if (input_action.size() != 4 || input_state.size() != 3) {
+        return false;
+    }
+    Eigen::MatrixXd output_states;
+    if (!predict(
+            input_action.transpose(),
+            input_state.transpose(),
+            &output_states,
+            nullptr)) {
+        return false;
+    }
+    *output_state = output_states.row(0).transpose();
+    return true;
+}
+
+bool GPModel::predict_states(
+    const Eigen::MatrixXd& input_actions,
+    const Eigen::MatrixXd& input_states,
+    Eigen::MatrixXd* output_states) const {
+    return predict(input_actions, input_states, output_states, nullptr);
+}
+
+bool GPModel::predict_distribution(
+    const Eigen::MatrixXd& input_actions,
+    const Eigen::MatrixXd& input_states,
+    Eigen::MatrixXd* output_states,
+    Eigen::MatrixXd* output_variances) const {
+    return predict(
+        input_actions, input_states, output_states, output_variances);
+}
+
+Eigen::MatrixXd GPModel::get_inputs(const Eigen::MatrixXd& actions) {
+    // Action vector is [speed, aspect_ratio, edge_offset, heading_offset]
+    Eigen::MatrixXd inputs(actions.rows(), kInputSize);
+    inputs.col(0) = actions.col(0);
+    inputs.col(1) = actions.col(2);
+    inputs.col(2) = actions.col(1);
+    return inputs;
+}
+
+Eigen::MatrixXd GPModel::get_targets(
+    const Eigen::MatrixXd& start_states,
+    const Eigen::MatrixXd& end_states) {
+    // Inverse of the state update in predict(); the distance is the
+    // projection of the displacement onto the direction given by dtheta
+    Eigen::MatrixXd targets(start_states.rows(), kOutputSize);
+    for (int i = 0; i < start_states.rows(); ++i) {
+        const double dtheta = utils::angle_normalization(
+            end_states(i, 2) - start_states(i, 2) + M_PI) - M_PI;
+        const double dx = end_states(i, 0) - start_states(i, 0);
+        const double dy = end_states(i, 1) - start_states(i, 1);
+        targets(i, 0) = dx * cos(dtheta) + dy * sin(dtheta);
+        targets(i, 1) = dtheta;
+    }
+    return targets;
+}
+
+bool GPModel::predict(
+    const Eigen::MatrixXd& input_actions,
+    const Eigen::MatrixXd& input_states,
+    Eigen::MatrixXd* output_states,
+    Eigen::MatrixXd* output_variances) const {
+    if (input_actions.cols() != 4 || input_states.cols() != 3 ||
+        input_actions.rows() != input_states.rows()) {
+        return false;
+    }
+
+    Eigen::MatrixXd means;
+    Eigen::MatrixXd variances;
+    if (!predict_targets(
+            get_inputs(input_actions),
+            &means,
+            output_variances == nullptr ? nullptr : &variances)) {
+        return false;
+    }
+
+    const Eigen::ArrayXd distance = means.col(0).array();
+    const Eigen::ArrayXd dtheta = means.col(1).array();
+    const Eigen::ArrayXd cos_dtheta = dtheta.cos();
+    const Eigen::ArrayXd sin_dtheta = dtheta.sin();
+    output_states->resize(input_states.rows(), 3);
+    output_states->col(0) =
+        (input_states.col(0).array() + distance * cos_dtheta).matrix();
+    output_states->col(1) =
+        (input_states.col(1).array() + distance * sin_dtheta).matrix();
+    output_states->col(2) = (input_states.col(2).array() + dtheta).matrix();
+
+    if (output_variances != nullptr) {
+        // Diagonal of J * diag(var_distance, var_dtheta) * J^T where J is the
+        // jacobian of the end state w.r.t. [distance, dtheta]
+        const Eigen::ArrayXd var_distance = variances.col(0).array();
+        const Eigen::ArrayXd var_dtheta = variances.col(1).array();
+        output_variances->resize(input_states.rows(), 3);
+        output_variances->col(0) = (cos_dtheta.square() * var_distance +
+            distance.square() * sin_dtheta.square() * var_dtheta).matrix();
+        output_variances->col(1) = (sin_dtheta.square() * var_distance +
+            distance.square() * cos_dtheta.square() * var_dtheta).matrix();
+        output_variances->col(2) = variances.col(1);
+    }
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
@@ -69,5 +69,127 @@ bool GPRModel::predict_state(
     return true;
 }
 
+PyObject* GPRModel::create_batch_input(
+        const Eigen::MatrixXd& input_actions) const {
+    PyObject* p_input = PyList_New(input_actions.rows());
+    for (int i = 0; i < input_actions.rows(); ++i) {
+        // Get speed, edge_offset, aspect_ratio into Python list
+        PyObject* p_list = PyList_New(3);
+        PyList_SetItem(p_list, 0, Py_BuildValue("f", input_actions(i, 0)));
+        PyList_SetItem(p_list, 1, Py_BuildValue("f", input_actions(i, 2)));
+        PyList_SetItem(p_list, 2, Py_BuildValue("f", input_actions(i, 1)));
+        PyList_SetItem(p_input, i, p_list);
+    }
+    return p_input;
+}
+
+PyObject* GPRModel::run_batch_inference(
+        const char* function_name,
+        const Eigen::MatrixXd& input_actions) const {
+    PyObject* p_inference_fn =
+        PyObject_GetAttrString(m_framework->get_module(), function_name);
+    if (p_inference_fn == NULL) {
+        return NULL;
+    }
+    PyObject* p_input = create_batch_input(input_actions);
+    PyObject* p_args = PyTuple_Pack(2, m_framework->get_model(), p_input);
+    PyObject* p_result = PyObject_CallObject(p_inference_fn, p_args);
+    Py_DecRef(p_args);
+    Py_DecRef(p_input);
+    Py_DecRef(p_inference_fn);
+    return p_result;
+}
+
+bool GPRModel::predict_states(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states) const {
+    if (input_actions.cols() != 4 || input_states.cols() != 3 ||
+        input_actions.rows() != input_states.rows()) {
+        return false;
+    }
+    output_states->resize(input_states.rows(), 3);
+    if (input_states.rows() == 0) {
+        return true;
+    }
+
+    // Model output is [[distance, dtheta], ...]
+    PyObject* p_result = run_batch_inference("batch_inference", input_actions);
+    if (p_result == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < input_states.rows(); ++i) {
+        PyObject* p_row = PyList_GetItem(p_result, i);
+        const double distance = PyFloat_AsDouble(PyList_GetItem(p_row, 0));
+        const double dtheta = PyFloat_AsDouble(PyList_GetItem(p_row, 1));
+        (*output_states)(i, 0) = input_states(i, 0) + distance * cos(dtheta);
+        (*output_states)(i, 1) = input_states(i, 1) + distance * sin(dtheta);
+        (*output_states)(i, 2) = input_states(i, 2) + dtheta;
+    }
+    Py_DecRef(p_result);
+    return true;
+}
+
+bool GPRModel::predict_distribution(
+        const Eigen::MatrixXd& input_actions,
+        const Eigen::MatrixXd& input_states,
+        Eigen::MatrixXd* output_states,
+        Eigen::MatrixXd* output_variances) const {
+    if (input_actions.cols() != 4 || input_states.cols() != 3 ||
+        input_actions.rows() != input_states.rows()) {
+        return false;
+    }
+    output_states->resize(input_states.rows(), 3);
+    output_variances->resize(input_states.rows(), 3);
+    if (input_states.rows() == 0) {
+        return true;
+    }
+
+    // Model output is ([[distance, dtheta], ...], [[std], ...]); the standard
+    // deviation is shared by both outputs unless the model reports one per
+    // output
+    PyObject* p_result =
+        run_batch_inference("batch_inference_with_std", input_actions);
+    if (p_result == NULL) {
+        return false;
+    }
+    PyObject* p_mean = PyTuple_GetItem(p_result, 0);
+    PyObject* p_std = PyTuple_GetItem(p_result, 1);
+
+    for (int i = 0; i < input_states.rows(); ++i) {
+        PyObject* p_mean_row = PyList_GetItem(p_mean, i);
+        const double distance =
+            PyFloat_AsDouble(PyList_GetItem(p_mean_row, 0));
+        const double dtheta = PyFloat_AsDouble(PyList_GetItem(p_mean_row, 1));
+
+        PyObject* p_std_row = PyList_GetItem(p_std, i);
+        const double distance_std =
+            PyFloat_AsDouble(PyList_GetItem(p_std_row, 0));
+        const double dtheta_std = PyList_Size(p_std_row) > 1 ?
+            PyFloat_AsDouble(PyList_GetItem(p_std_row, 1)) : distance_std;
+
+        const double cos_dtheta = cos(dtheta);
+        const double sin_dtheta = sin(dtheta);
+        (*output_states)(i, 0) = input_states(i, 0) + distance * cos_dtheta;
+        (*output_states)(i, 1) = input_states(i, 1) + distance * sin_dtheta;
+        (*output_states)(i, 2) = input_states(i, 2) + dtheta;
+
+        // Diagonal of J * diag(var_distance, var_dtheta) * J^T where J is
+        // the jacobian of the end state w.r.t. [distance, dtheta]
+        const double var_distance = distance_std * distance_std;
+        const double var_dtheta = dtheta_std * dtheta_std;
+        (*output_variances)(i, 0) =
+            cos_dtheta * cos_dtheta * var_distance +
+            distance * distance * sin_dtheta * sin_dtheta * var_dtheta;
+        (*output_variances)(i, 1) =
+            sin_dtheta * sin_dtheta * var_distance +
+            distance * distance * cos_dtheta * cos_dtheta * var_dtheta;
+        (*output_variances)(i, 2) = var_dtheta;
+    }
+    Py_DecRef(p_result);
+    return true;
+}
+
 }  // namespace model
 }  // namespace libcozmo
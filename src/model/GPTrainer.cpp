@@ -0,0 +1,359 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/GPTrainer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include "model/GPModel.hpp"
+
+namespace libcozmo {
+namespace model {
+
+/// Bounds of the log hyperparameters
+static const double kLogLowerBound = std::log(1e-5);
+static const double kLogUpperBound = std::log(1e5);
+
+/// Number of correction pairs kept by L-BFGS
+static constexpr int kHistorySize = 7;
+
+GPTrainer::GPTrainer(const Parameters& parameters, const int& num_threads) :
+    m_parameters(parameters),
+    m_pool(new utils::ThreadPool(num_threads)) {
+    if (m_parameters.num_restarts <= 0 || m_parameters.max_iterations < 0 ||
+        m_parameters.max_samples <= 0) {
+        throw std::invalid_argument(
+            "[GPTrainer] Restarts and samples must be positive");
+    }
+}
+
+bool GPTrainer::train(
+    const Dataset& dataset,
+    GPParameters* model,
+    Result* result) const {
+    return train(
+        GPModel::get_inputs(dataset.actions()),
+        GPModel::get_targets(dataset.start_states(), dataset.end_states()),
+        model,
+        result);
+}
+
+bool GPTrainer::train(
+    const Eigen::MatrixXd& all_inputs,
+    const Eigen::MatrixXd& all_targets,
+    GPParameters* model,
+    Result* result) const {
+    if (all_inputs.rows() != all_targets.rows() || all_inputs.rows() < 2) {
+        return false;
+    }
+
+    std::mt19937 generator(m_parameters.seed);
+    Eigen::MatrixXd inputs = all_inputs;
+    Eigen::MatrixXd targets = all_targets;
+    if (all_inputs.rows() > m_parameters.max_samples) {
+        std::vector<int> indices(all_inputs.rows());
+        std::iota(indices.begin(), indices.end(), 0);
+        std::shuffle(indices.begin(), indices.end(), generator);
+        inputs.resize(m_parameters.max_samples, all_inputs.cols());
+        targets.resize(m_parameters.max_samples, all_targets.cols());
+        for (int i = 0; i < m_parameters.max_samples; ++i) {
+            inputs.row(i) = all_inputs.row(indices[i]);
+            targets.row(i) = all_targets.row(indices[i]);
+        }
+    }
+    const int num_samples = inputs.rows();
+
+    // Normalize the targets like scikit-learn's normalize_y
+    const Eigen::VectorXd target_mean = targets.colwise().mean().transpose();
+    Eigen::VectorXd target_scale = ((targets.rowwise() -
+        target_mean.transpose()).colwise().squaredNorm().transpose() /
+        num_samples).cwiseSqrt();
+    target_scale = (target_scale.array() > 0.0).select(target_scale, 1.0);
+    const Eigen::MatrixXd normalized = ((targets.rowwise() -
+        target_mean.transpose()).array().rowwise() /
+        target_scale.transpose().array()).matrix();
+
+    // Initial length scales from the spread of each input dimension
+    Eigen::VectorXd input_scale = ((inputs.rowwise() -
+        inputs.colwise().mean()).colwise().squaredNorm().transpose() /
+        num_samples).cwiseSqrt();
+    input_scale = (input_scale.array() > 0.0).select(input_scale, 1.0);
+    if (m_parameters.isotropic) {
+        input_scale = Eigen::VectorXd::Constant(1, input_scale.mean());
+    }
+    const int num_length_scales = input_scale.size();
+
+    std::vector<Eigen::VectorXd> starts(m_parameters.num_restarts);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    for (int r = 0; r < m_parameters.num_restarts; ++r) {
+        Eigen::VectorXd& start = starts[r];
+        start.resize(num_length_scales + 2);
+        start.head(num_length_scales) = input_scale.array().log();
+        start[num_length_scales] = 0.0;
+        start[num_length_scales + 1] = std::log(0.1);
+        if (r > 0) {
+            // Length scales and signal variance within a factor of 10 of
+            // the defaults, noise variance in [1e-4, 1]
+            for (int i = 0; i <= num_length_scales; ++i) {
+                start[i] += std::log(10.0) * uniform(generator);
+            }
+            start[num_length_scales + 1] =
+                std::log(1e-2) + std::log(100.0) * uniform(generator);
+        }
+    }
+
+    std::vector<double> values(
+        m_parameters.num_restarts, -std::numeric_limits<double>::infinity());
+    m_pool->parallel_for(m_parameters.num_restarts, [&](int r) {
+        double value;
+        if (optimize(inputs, normalized, &starts[r], &value)) {
+            values[r] = value;
+        }
+    });
+
+    const int best = std::max_element(values.begin(), values.end()) -
+        values.begin();
+    if (!std::isfinite(values[best])) {
+        return false;
+    }
+
+    // Final model at the best hyperparameters
+    const Eigen::VectorXd hyperparameters = starts[best].array().exp();
+    model->kernel_type = m_parameters.kernel_type;
+    model->length_scales = hyperparameters.head(num_length_scales);
+    model->signal_variance = hyperparameters[num_length_scales];
+    model->noise_variance = hyperparameters[num_length_scales + 1];
+
+    Eigen::MatrixXd covariance;
+    ModelFile::create_kernel(
+        model->kernel_type, model->length_scales, model->signal_variance)
+        ->compute(inputs, inputs, &covariance);
+    covariance.diagonal().array() += model->noise_variance;
+    const Eigen::LLT<Eigen::MatrixXd> llt(covariance);
+    if (llt.info() != Eigen::Success) {
+        return false;
+    }
+    model->inputs = inputs;
+    model->weights = llt.solve(normalized);
+    model->cholesky = llt.matrixL();
+    model->target_mean = target_mean;
+    model->target_scale = target_scale;
+
+    if (result) {
+        result->log_marginal_likelihood = values[best];
+        result->restart_log_marginal_likelihoods = values;
+        result->best_restart = best;
+        result->num_samples = num_samples;
+    }
+    return true;
+}
+
+bool GPTrainer::log_marginal_likelihood(
+    const KernelType& kernel_type,
+    const Eigen::MatrixXd& inputs,
+    const Eigen::MatrixXd& targets,
+    const Eigen::VectorXd& log_hyperparameters,
+    double* value,
+    Eigen::VectorXd* gradient) {
+    const int num_length_scales = log_hyperparameters.size() - 2;
+    if (num_length_scales <= 0 || inputs.rows() != targets.rows() ||
+        (num_length_scales != 1 && num_length_scales != inputs.cols())) {
+        return false;
+    }
+    const Eigen::VectorXd hyperparameters = log_hyperparameters.array().exp();
+    const double noise_variance = hyperparameters[num_length_scales + 1];
+    const int size = inputs.rows();
+    const int num_outputs = targets.cols();
+
+    std::shared_ptr<Kernel> kernel;
+    try {
+        kernel = ModelFile::create_kernel(
+            kernel_type,
+            hyperparameters.head(num_length_scales),
+            hyperparameters[num_length_scales]);
+    } catch (const std::invalid_argument&) {
+        return false;
+    }
+
+    Eigen::MatrixXd covariance;
+    std::vector<Eigen::MatrixXd> length_scale_gradients;
+    kernel->compute_gradients(inputs, &covariance, &length_scale_gradients);
+    Eigen::MatrixXd noisy_covariance = covariance;
+    noisy_covariance.diagonal().array() += noise_variance;
+
+    // Eigen's LLT factorizes large matrices block by block
+    const Eigen::LLT<Eigen::MatrixXd> llt(noisy_covariance);
+    if (llt.info() != Eigen::Success) {
+        return false;
+    }
+    const Eigen::MatrixXd alpha = llt.solve(targets);
+    const double log_determinant =
+        2.0 * llt.matrixLLT().diagonal().array().log().sum();
+    *value = -0.5 * (targets.array() * alpha.array()).sum() -
+        0.5 * num_outputs * log_determinant -
+        0.5 * size * num_outputs * std::log(2.0 * M_PI);
+    if (!std::isfinite(*value)) {
+        return false;
+    }
+    if (gradient == nullptr) {
+        return true;
+    }
+
+    // dL/dθ = tr((α α^T - p K^-1) dK/dθ) / 2
+    Eigen::MatrixXd W = llt.solve(Eigen::MatrixXd::Identity(size, size));
+    W = alpha * alpha.transpose() - num_outputs * W;
+
+    gradient->resize(num_length_scales + 2);
+    for (int d = 0; d < num_length_scales; ++d) {
+        (*gradient)[d] =
+            0.5 * (W.array() * length_scale_gradients[d].array()).sum();
+    }
+    (*gradient)[num_length_scales] =
+        0.5 * (W.array() * covariance.array()).sum();
+    (*gradient)[num_length_scales + 1] = 0.5 * noise_variance * W.trace();
+    return true;
+}
+
+bool GPTrainer::optimize(
+    const Eigen::MatrixXd& inputs,
+    const Eigen::MatrixXd& targets,
+    Eigen::VectorXd* log_hyperparameters,
+    double* value) const {
+    // L-BFGS on the negative log marginal likelihood with the iterates
+    // projected onto the bounds
+    auto project = [](const Eigen::VectorXd& x) -> Eigen::VectorXd {
+        return x.cwiseMax(kLogLowerBound).cwiseMin(kLogUpperBound);
+    };
+    auto objective = [&](
+        const Eigen::VectorXd& x, double* f, Eigen::VectorXd* g) {
+        if (!log_marginal_likelihood(
+                m_parameters.kernel_type, inputs, targets, x, f, g)) {
+            return false;
+        }
+        *f = -*f;
+        *g = -*g;
+        return true;
+    };
+
+    Eigen::VectorXd x = project(*log_hyperparameters);
+    double f;
+    Eigen::VectorXd g;
+    if (!objective(x, &f, &g)) {
+        return false;
+    }
+
+    std::deque<Eigen::VectorXd> s_history;
+    std::deque<Eigen::VectorXd> y_history;
+    for (int iteration = 0; iteration < m_parameters.max_iterations;
+         ++iteration) {
+        // Gradient components pushing against an active bound don't count
+        Eigen::VectorXd projected_gradient = g;
+        for (int i = 0; i < x.size(); ++i) {
+            if ((x[i] <= kLogLowerBound && g[i] > 0) ||
+                (x[i] >= kLogUpperBound && g[i] < 0)) {
+                projected_gradient[i] = 0.0;
+            }
+        }
+        if (projected_gradient.norm() < m_parameters.gradient_tolerance) {
+            break;
+        }
+
+        // Two loop recursion for the quasi-Newton direction
+        Eigen::VectorXd direction = -g;
+        const int history = s_history.size();
+        std::vector<double> rho(history);
+        std::vector<double> a(history);
+        for (int i = history - 1; i >= 0; --i) {
+            rho[i] = 1.0 / y_history[i].dot(s_history[i]);
+            a[i] = rho[i] * s_history[i].dot(direction);
+            direction -= a[i] * y_history[i];
+        }
+        if (history > 0) {
+            direction *= s_history.back().dot(y_history.back()) /
+                y_history.back().squaredNorm();
+        } else {
+            direction /= std::max(1.0, g.norm());
+        }
+        for (int i = 0; i < history; ++i) {
+            const double b = rho[i] * y_history[i].dot(direction);
+            direction += (a[i] - b) * s_history[i];
+        }
+        if (g.dot(direction) >= 0.0) {
+            direction = -g / std::max(1.0, g.norm());
+            s_history.clear();
+            y_history.clear();
+        }
+
+        // Backtracking line search with the Armijo condition
+        bool accepted = false;
+        Eigen::VectorXd next_x;
+        double next_f;
+        Eigen::VectorXd next_g;
+        for (double step = 1.0; step > 1e-10; step *= 0.5) {
+            next_x = project(x + step * direction);
+            if (objective(next_x, &next_f, &next_g) &&
+                next_f <= f + 1e-4 * g.dot(next_x - x)) {
+                accepted = true;
+                break;
+            }
+        }
+        if (!accepted) {
+            break;
+        }
+
+        const Eigen::VectorXd s = next_x - x;
+        const Eigen::VectorXd y = next_g - g;
+        if (s.dot(y) > 1e-10) {
+            s_history.push_back(s);
+            y_history.push_back(y);
+            if (s_history.size() > kHistorySize) {
+                s_history.pop_front();
+                y_history.pop_front();
+            }
+        }
+        const double improvement = f - next_f;
+        x = next_x;
+        f = next_f;
+        g = next_g;
+        if (improvement < 1e-10 * (1.0 + std::abs(f))) {
+            break;
+        }
+    }
+
+    *log_hyperparameters = x;
+    *value = -f;
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/Kernel.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace model {
+
+Kernel::Kernel(
+    const Eigen::VectorXd& length_scales,
+    const double& signal_variance) : \
+    m_length_scales(length_scales),
+    m_signal_variance(signal_variance) {
+    if (m_length_scales.size() == 0 || (m_length_scales.array() <= 0).any()) {
+        throw std::invalid_argument(
+            "[Kernel] length scales must be positive");
+    }
+    if (m_signal_variance <= 0) {
+        throw std::invalid_argument(
+            "[Kernel] signal variance must be positive");
+    }
+}
+
+double Kernel::evaluate(
+    const Eigen::VectorXd& input_1,
+    const Eigen::VectorXd& input_2) const {
+    Eigen::MatrixXd covariance;
+    compute(input_1.transpose(), input_2.transpose(), &covariance);
+    return covariance(0, 0);
+}
+
+void Kernel::compute(
+    const Eigen::Ref<const Eigen::MatrixXd>& inputs_1,
+    const Eigen::Ref<const Eigen::MatrixXd>& inputs_2,
+    Eigen::MatrixXd* covariance) const {
+    const Eigen::MatrixXd scaled_1 = scale(inputs_1);
+    const Eigen::MatrixXd scaled_2 = scale(inputs_2);
+
+    // |a - b|^2 = |a|^2 + |b|^2 - 2 a.b so the bulk of the work is a single
+    // matrix product
+    Eigen::ArrayXXd values = (-2.0 * scaled_1 * scaled_2.transpose()).array();
+    values.colwise() += scaled_1.rowwise().squaredNorm().array();
+    values.rowwise() += scaled_2.rowwise().squaredNorm().array().transpose();
+    values = values.max(0.0);
+
+    profile(&values);
+    *covariance = values.matrix();
+}
+
+void Kernel::compute_gradients(
+    const Eigen::Ref<const Eigen::MatrixXd>& inputs,
+    Eigen::MatrixXd* covariance,
+    std::vector<Eigen::MatrixXd>* gradients) const {
+    const Eigen::MatrixXd scaled = scale(inputs);
+    const int size = scaled.rows();
+
+    Eigen::ArrayXXd values = (-2.0 * scaled * scaled.transpose()).array();
+    values.colwise() += scaled.rowwise().squaredNorm().array();
+    values.rowwise() += scaled.rowwise().squaredNorm().array().transpose();
+    values = values.max(0.0);
+
+    Eigen::ArrayXXd derivatives = values;
+    profile_derivative(&derivatives);
+    gradients->resize(m_length_scales.size());
+
+    // dr^2 / dlog(l_d) = -2 (x_d - x'_d)^2 / l_d^2
+    if (m_length_scales.size() == 1) {
+        (*gradients)[0] = (-2.0 * derivatives * values).matrix();
+    } else {
+        const Eigen::VectorXd ones = Eigen::VectorXd::Ones(size);
+        for (int d = 0; d < m_length_scales.size(); ++d) {
+            const Eigen::ArrayXXd differences = (scaled.col(d) *
+                ones.transpose() - ones * scaled.col(d).transpose()).array();
+            (*gradients)[d] =
+                (-2.0 * derivatives * differences.square()).matrix();
+        }
+    }
+
+    profile(&values);
+    *covariance = values.matrix();
+}
+
+const Eigen::VectorXd& Kernel::length_scales() const {
+    return m_length_scales;
+}
+
+double Kernel::signal_variance() const {
+    return m_signal_variance;
+}
+
+Eigen::MatrixXd Kernel::scale(
+    const Eigen::Ref<const Eigen::MatrixXd>& inputs) const {
+    if (m_length_scales.size() == 1) {
+        return inputs / m_length_scales[0];
+    }
+    return inputs * m_length_scales.cwiseInverse().asDiagonal();
+}
+
+void RBFKernel::profile(Eigen::ArrayXXd* values) const {
+    *values = m_signal_variance * (-0.5 * *values).exp();
+}
+
+void RBFKernel::profile_derivative(Eigen::ArrayXXd* values) const {
+    *values = -0.5 * m_signal_variance * (-0.5 * *values).exp();
+}
+
+MaternKernel::MaternKernel(
+    const Eigen::VectorXd& length_scales,
+    const double& signal_variance,
+    const double& nu) : \
+    Kernel(length_scales, signal_variance),
+    m_nu(nu) {
+    if (m_nu != 1.5 && m_nu != 2.5) {
+        throw std::invalid_argument("[MaternKernel] nu must be 1.5 or 2.5");
+    }
+}
+
+double MaternKernel::nu() const {
+    return m_nu;
+}
+
+void MaternKernel::profile(Eigen::ArrayXXd* values) const {
+    if (m_nu == 1.5) {
+        const Eigen::ArrayXXd r = std::sqrt(3.0) * values->sqrt();
+        *values = m_signal_variance * (1.0 + r) * (-r).exp();
+    } else {
+        const Eigen::ArrayXXd r = std::sqrt(5.0) * values->sqrt();
+        *values = m_signal_variance * (1.0 + r + r.square() / 3.0) * (-r).exp();
+    }
+}
+
+void MaternKernel::profile_derivative(Eigen::ArrayXXd* values) const {
+    if (m_nu == 1.5) {
+        const Eigen::ArrayXXd r = std::sqrt(3.0) * values->sqrt();
+        *values = -1.5 * m_signal_variance * (-r).exp();
+    } else {
+        const Eigen::ArrayXXd r = std::sqrt(5.0) * values->sqrt();
+        *values = -5.0 / 6.0 * m_signal_variance * (1.0 + r) * (-r).exp();
+    }
+}
+
+}  // namespace model
+}  // namespace libcozmo
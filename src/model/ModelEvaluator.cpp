@@ -0,0 +1,251 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/ModelEvaluator.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <numeric>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace model {
+
+/// Smallest number of samples handed to one thread
+static constexpr int kMinRowsPerTask = 256;
+
+ModelEvaluator::ModelEvaluator(
+    const std::vector<std::shared_ptr<Model>>& models,
+    const std::vector<std::string>& names,
+    const int& num_threads) :
+    m_models(models),
+    m_names(names),
+    m_accumulators(models.size()),
+    m_pool(new utils::ThreadPool(num_threads)) {
+    if (m_models.empty() || m_models.size() != m_names.size()) {
+        throw std::invalid_argument(
+            "[ModelEvaluator] Need one name per model and at least one model");
+    }
+    for (const auto& model : m_models) {
+        if (!model) {
+            throw std::invalid_argument("[ModelEvaluator] Null model given");
+        }
+    }
+}
+
+void ModelEvaluator::evaluate(const Dataset& dataset) {
+    const int num_samples = dataset.size();
+    if (num_samples == 0) {
+        return;
+    }
+
+    Eigen::VectorXd position_errors(num_samples);
+    Eigen::VectorXd heading_errors(num_samples);
+    for (int m = 0; m < static_cast<int>(m_models.size()); ++m) {
+        const Model& model = *m_models[m];
+        const int num_tasks = model.is_thread_safe() ?
+            std::max(1, std::min(
+                m_pool->size() + 1, num_samples / kMinRowsPerTask)) : 1;
+        std::vector<char> success(num_tasks, 0);
+
+        const auto start = std::chrono::steady_clock::now();
+        auto task = [&](int i) {
+            const int begin =
+                static_cast<long>(num_samples) * i / num_tasks;
+            const int end =
+                static_cast<long>(num_samples) * (i + 1) / num_tasks;
+            Eigen::VectorXd position;
+            Eigen::VectorXd heading;
+            success[i] = evaluate_rows(
+                model, dataset, begin, end, &position, &heading);
+            if (success[i]) {
+                position_errors.segment(begin, end - begin) = position;
+                heading_errors.segment(begin, end - begin) = heading;
+            }
+        };
+        if (num_tasks == 1) {
+            task(0);
+        } else {
+            m_pool->parallel_for(num_tasks, task);
+        }
+
+        Accumulator& accumulator = m_accumulators[m];
+        accumulator.seconds += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+        for (int i = 0; i < num_tasks; ++i) {
+            const int begin =
+                static_cast<long>(num_samples) * i / num_tasks;
+            const int end =
+                static_cast<long>(num_samples) * (i + 1) / num_tasks;
+            if (!success[i]) {
+                accumulator.num_failures += end - begin;
+                continue;
+            }
+            accumulator.position_errors.insert(
+                accumulator.position_errors.end(),
+                position_errors.data() + begin,
+                position_errors.data() + end);
+            accumulator.heading_errors.insert(
+                accumulator.heading_errors.end(),
+                heading_errors.data() + begin,
+                heading_errors.data() + end);
+        }
+    }
+}
+
+int ModelEvaluator::evaluate_file(
+    const std::string& dataset_path,
+    const int& chunk_size) {
+    if (chunk_size <= 0) {
+        throw std::invalid_argument("[ModelEvaluator] Invalid chunk_size");
+    }
+    DatasetReader reader(dataset_path);
+    auto read_chunk = [&reader, chunk_size]() {
+        Dataset chunk;
+        reader.read(chunk_size, &chunk);
+        return chunk;
+    };
+
+    int num_samples = 0;
+    Dataset chunk = read_chunk();
+    while (chunk.size() > 0) {
+        std::future<Dataset> next = std::async(std::launch::async, read_chunk);
+        evaluate(chunk);
+        num_samples += chunk.size();
+        chunk = next.get();
+    }
+    return num_samples;
+}
+
+std::vector<ModelEvaluator::Report> ModelEvaluator::get_reports() const {
+    std::vector<Report> reports;
+    for (int m = 0; m < static_cast<int>(m_models.size()); ++m) {
+        const Accumulator& accumulator = m_accumulators[m];
+        std::vector<double> position_errors = accumulator.position_errors;
+        std::vector<double> heading_errors = accumulator.heading_errors;
+
+        Report report;
+        report.name = m_names[m];
+        report.num_failures = accumulator.num_failures;
+        report.num_samples = position_errors.size() + report.num_failures;
+        report.position_error = summarize(&position_errors);
+        report.heading_error = summarize(&heading_errors);
+        report.seconds = accumulator.seconds;
+        report.samples_per_second = accumulator.seconds > 0.0 ?
+            report.num_samples / accumulator.seconds : 0.0;
+        reports.push_back(report);
+    }
+    return reports;
+}
+
+void ModelEvaluator::reset() {
+    std::fill(m_accumulators.begin(), m_accumulators.end(), Accumulator());
+}
+
+void ModelEvaluator::compute_errors(
+    const Eigen::MatrixXd& predicted_states,
+    const Eigen::MatrixXd& observed_states,
+    Eigen::VectorXd* position_errors,
+    Eigen::VectorXd* heading_errors) {
+    const Eigen::ArrayXd dx =
+        predicted_states.col(0).array() - observed_states.col(0).array();
+    const Eigen::ArrayXd dy =
+        predicted_states.col(1).array() - observed_states.col(1).array();
+    Eigen::ArrayXd dtheta =
+        predicted_states.col(2).array() - observed_states.col(2).array();
+    dtheta -= 2.0 * M_PI * ((dtheta + M_PI) / (2.0 * M_PI)).floor();
+
+    *position_errors = (dx.square() + dy.square()).sqrt().matrix();
+    *heading_errors = dtheta.abs().matrix();
+}
+
+ModelEvaluator::ErrorStatistics ModelEvaluator::summarize(
+    std::vector<double>* errors) {
+    ErrorStatistics statistics = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    const int size = errors->size();
+    if (size == 0) {
+        return statistics;
+    }
+
+    double sum = 0.0;
+    double sum_squares = 0.0;
+    for (const double& error : *errors) {
+        sum += error;
+        sum_squares += error * error;
+    }
+    statistics.mean = sum / size;
+    statistics.rmse = std::sqrt(sum_squares / size);
+
+    // Nearest rank percentiles, selected in increasing order so every
+    // selection only partitions the remaining range
+    auto percentile = [errors, size](double p, int from) {
+        const int rank = std::max(from, std::min(
+            size - 1, static_cast<int>(std::ceil(p * size)) - 1));
+        std::nth_element(
+            errors->begin() + from, errors->begin() + rank, errors->end());
+        return rank;
+    };
+    const int median = percentile(0.5, 0);
+    statistics.median = (*errors)[median];
+    const int rank_90 = percentile(0.9, median);
+    statistics.percentile_90 = (*errors)[rank_90];
+    const int rank_99 = percentile(0.99, rank_90);
+    statistics.percentile_99 = (*errors)[rank_99];
+    statistics.max =
+        *std::max_element(errors->begin() + rank_99, errors->end());
+    return statistics;
+}
+
+bool ModelEvaluator::evaluate_rows(
+    const Model& model,
+    const Dataset& dataset,
+    const int& begin,
+    const int& end,
+    Eigen::VectorXd* position_errors,
+    Eigen::VectorXd* heading_errors) {
+    const int size = end - begin;
+    Eigen::MatrixXd predicted_states;
+    if (!model.predict_states(
+            dataset.actions().middleRows(begin, size),
+            dataset.start_states().middleRows(begin, size),
+            &predicted_states) ||
+        predicted_states.rows() != size || predicted_states.cols() < 3) {
+        return false;
+    }
+    compute_errors(
+        predicted_states,
+        dataset.end_states().middleRows(begin, size),
+        position_errors,
+        heading_errors);
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
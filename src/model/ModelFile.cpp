@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/ModelFile.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace model {
+
+constexpr uint32_t ModelFile::kVersion;
+constexpr uint32_t ModelFile::kByteOrderMark;
+
+static const char kMagic[8] = {'C', 'O', 'Z', 'M', 'O', 'G', 'P', '\0'};
+
+static_assert(
+    sizeof(ModelFile::Header) % sizeof(double) == 0,
+    "model file arrays must be aligned to doubles");
+
+ModelFile::ModelFile(const std::string& model_path) : \
+    m_address(nullptr),
+    m_size(0) {
+    const int fd = open(model_path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::invalid_argument("[ModelFile] Invalid model_path");
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 ||
+        static_cast<size_t>(file_stat.st_size) < sizeof(Header)) {
+        close(fd);
+        throw std::invalid_argument("[ModelFile] Invalid model file");
+    }
+    m_size = file_stat.st_size;
+    m_address = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (m_address == MAP_FAILED) {
+        m_address = nullptr;
+        throw std::invalid_argument("[ModelFile] Unable to map model file");
+    }
+
+    const Header& file_header = header();
+    if (std::memcmp(file_header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        file_header.version != kVersion ||
+        file_header.byte_order != kByteOrderMark ||
+        file_header.kernel_type >
+            static_cast<uint32_t>(KernelType::MATERN_5_2) ||
+        (file_header.num_length_scales != 1 &&
+            file_header.num_length_scales != file_header.input_size)) {
+        munmap(m_address, m_size);
+        m_address = nullptr;
+        throw std::invalid_argument("[ModelFile] Invalid model file");
+    }
+
+    const size_t n = file_header.num_samples;
+    const size_t k = file_header.output_size;
+    m_target_mean_offset = file_header.num_length_scales;
+    m_target_scale_offset = m_target_mean_offset + k;
+    m_inputs_offset = m_target_scale_offset + k;
+    m_weights_offset = m_inputs_offset + n * file_header.input_size;
+    m_cholesky_offset = m_weights_offset + n * k;
+    const size_t num_doubles =
+        m_cholesky_offset + (file_header.has_cholesky ? n * n : 0);
+    if (m_size != sizeof(Header) + num_doubles * sizeof(double)) {
+        munmap(m_address, m_size);
+        m_address = nullptr;
+        throw std::invalid_argument("[ModelFile] Truncated model file");
+    }
+}
+
+ModelFile::~ModelFile() {
+    if (m_address != nullptr) {
+        munmap(m_address, m_size);
+    }
+}
+
+bool ModelFile::write(
+    const std::string& model_path,
+    const GPParameters& parameters) {
+    const int n = parameters.inputs.rows();
+    const int k = parameters.weights.cols();
+    if (parameters.weights.rows() != n ||
+        (parameters.length_scales.size() != 1 &&
+            parameters.length_scales.size() != parameters.inputs.cols()) ||
+        parameters.target_mean.size() != k ||
+        parameters.target_scale.size() != k ||
+        (parameters.cholesky.size() != 0 &&
+            (parameters.cholesky.rows() != n ||
+             parameters.cholesky.cols() != n))) {
+        return false;
+    }
+
+    Header file_header;
+    std::memset(&file_header, 0, sizeof(Header));
+    std::memcpy(file_header.magic, kMagic, sizeof(kMagic));
+    file_header.version = kVersion;
+    file_header.kernel_type = static_cast<uint32_t>(parameters.kernel_type);
+    file_header.num_samples = n;
+    file_header.input_size = parameters.inputs.cols();
+    file_header.output_size = k;
+    file_header.num_length_scales = parameters.length_scales.size();
+    file_header.has_cholesky = parameters.cholesky.size() != 0;
+    file_header.byte_order = kByteOrderMark;
+    file_header.signal_variance = parameters.signal_variance;
+    file_header.noise_variance = parameters.noise_variance;
+
+    std::ofstream file(model_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return false;
+    }
+    auto write_array = [&file](const double* data, const size_t& size) {
+        file.write(
+            reinterpret_cast<const char*>(data), size * sizeof(double));
+    };
+    file.write(reinterpret_cast<const char*>(&file_header), sizeof(Header));
+    write_array(
+        parameters.length_scales.data(), parameters.length_scales.size());
+    write_array(parameters.target_mean.data(), k);
+    write_array(parameters.target_scale.data(), k);
+    write_array(parameters.inputs.data(), parameters.inputs.size());
+    write_array(parameters.weights.data(), parameters.weights.size());
+    write_array(parameters.cholesky.data(), parameters.cholesky.size());
+    return file.good();
+}
+
+std::shared_ptr<Kernel> ModelFile::create_kernel(
+    const KernelType& kernel_type,
+    const Eigen::VectorXd& length_scales,
+    const double& signal_variance) {
+    switch (kernel_type) {
+        case KernelType::RBF:
+            return std::make_shared<RBFKernel>(length_scales, signal_variance);
+        case KernelType::MATERN_3_2:
+            return std::make_shared<MaternKernel>(
+                length_scales, signal_variance, 1.5);
+        case KernelType::MATERN_5_2:
+            return std::make_shared<MaternKernel>(
+                length_scales, signal_variance, 2.5);
+    }
+    throw std::invalid_argument("[ModelFile] Invalid kernel type");
+}
+
+const ModelFile::Header& ModelFile::header() const {
+    return *static_cast<const Header*>(m_address);
+}
+
+std::shared_ptr<Kernel> ModelFile::kernel() const {
+    return create_kernel(
+        static_cast<KernelType>(header().kernel_type),
+        length_scales(),
+        header().signal_variance);
+}
+
+ModelFile::ConstMatrixMap ModelFile::inputs() const {
+    return ConstMatrixMap(
+        data(m_inputs_offset), header().num_samples, header().input_size);
+}
+
+ModelFile::ConstMatrixMap ModelFile::weights() const {
+    return ConstMatrixMap(
+        data(m_weights_offset), header().num_samples, header().output_size);
+}
+
+ModelFile::ConstMatrixMap ModelFile::cholesky() const {
+    const int n = header().has_cholesky ? header().num_samples : 0;
+    return ConstMatrixMap(data(m_cholesky_offset), n, n);
+}
+
+ModelFile::ConstVectorMap ModelFile::target_mean() const {
+    return ConstVectorMap(data(m_target_mean_offset), header().output_size);
+}
+
+ModelFile::ConstVectorMap ModelFile::target_scale() const {
+    return ConstVectorMap(data(m_target_scale_offset), header().output_size);
+}
+
+ModelFile::ConstVectorMap ModelFile::length_scales() const {
+    return ConstVectorMap(data(0), header().num_length_scales);
+}
+
+const double* ModelFile::data(const size_t& offset) const {
+    return reinterpret_cast<const double*>(
+        static_cast<const char*>(m_address) + sizeof(Header)) + offset;
+}
+
+}  // namespace model
+}  // namespace libcozmo
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/NativeGPRModel.hpp"
+#include <stdexcept>
+
+namespace libcozmo {
+namespace model {
+
+NativeGPRModel::NativeGPRModel(const std::string& model_path) : \
+    m_file(new ModelFile(model_path)),
+    m_kernel(m_file->kernel()) {
+    if (m_file->header().input_size != kInputSize ||
+        m_file->header().output_size != kOutputSize) {
+        throw std::invalid_argument(
+            "[NativeGPRModel] Model has incorrect input or output size");
+    }
+}
+
+const ModelFile& NativeGPRModel::model_file() const {
+    return *m_file;
+}
+
+bool NativeGPRModel::predict_targets(
+    const Eigen::MatrixXd& inputs,
+    Eigen::MatrixXd* means,
+    Eigen::MatrixXd* variances) const {
+    if (inputs.cols() != kInputSize) {
+        return false;
+    }
+    const ModelFile::ConstMatrixMap cholesky = m_file->cholesky();
+    if (variances != nullptr && cholesky.size() == 0) {
+        return false;
+    }
+
+    Eigen::MatrixXd K_s;
+    m_kernel->compute(inputs, m_file->inputs(), &K_s);
+    *means = K_s * m_file->weights();
+    *means = ((means->array().rowwise() *
+        m_file->target_scale().transpose().array()).rowwise() +
+        m_file->target_mean().transpose().array()).matrix();
+
+    if (variances != nullptr) {
+        // k(x, x) - |L^-1 k|^2, scaled for each output
+        const Eigen::MatrixXd V = cholesky
+            .triangularView<Eigen::Lower>().solve(K_s.transpose());
+        const Eigen::ArrayXd variance = (m_kernel->signal_variance() -
+            V.colwise().squaredNorm().transpose().array()).max(0.0);
+        *variances = (variance.matrix() *
+            m_file->target_scale().cwiseAbs2().transpose());
+    }
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
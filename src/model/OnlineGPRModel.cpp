@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/OnlineGPRModel.hpp"
+#include <cmath>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace model {
+
+/// Jitter added to the diagonal of the covariance matrix for numerical
+/// stability
+static const double kJitter = 1e-8;
+
+OnlineGPRModel::OnlineGPRModel(
+    const std::shared_ptr<Kernel> kernel,
+    const double& noise_variance,
+    const int& max_samples) : \
+    m_kernel(kernel),
+    m_noise_variance(noise_variance),
+    m_max_samples(max_samples),
+    m_size(0) {
+    if (m_kernel == nullptr) {
+        throw std::invalid_argument("[OnlineGPRModel] kernel is a nullptr");
+    }
+    if (m_noise_variance < 0) {
+        throw std::invalid_argument(
+            "[OnlineGPRModel] noise variance must be non-negative");
+    }
+    if (m_max_samples <= 0) {
+        throw std::invalid_argument(
+            "[OnlineGPRModel] max samples must be positive");
+    }
+    m_inputs.resize(m_max_samples, kInputSize);
+    m_targets.resize(m_max_samples, kOutputSize);
+    m_cholesky = Eigen::MatrixXd::Zero(m_max_samples, m_max_samples);
+}
+
+bool OnlineGPRModel::add_sample(
+    const Eigen::VectorXd& action,
+    const Eigen::VectorXd& start_state,
+    const Eigen::VectorXd& end_state) {
+    if (action.size() != 4 || start_state.size() != 3 ||
+        end_state.size() != 3) {
+        return false;
+    }
+    const Eigen::MatrixXd input = get_inputs(action.transpose());
+    const Eigen::MatrixXd target =
+        get_targets(start_state.transpose(), end_state.transpose());
+    const bool added =
+        add_sample(input.row(0).transpose(), target.row(0).transpose());
+    update_weights();
+    return added;
+}
+
+bool OnlineGPRModel::add_samples(const Dataset& dataset) {
+    const Eigen::MatrixXd inputs = get_inputs(dataset.actions());
+    const Eigen::MatrixXd targets =
+        get_targets(dataset.start_states(), dataset.end_states());
+    bool success = true;
+    for (int i = 0; i < inputs.rows() && success; ++i) {
+        success = add_sample(
+            inputs.row(i).transpose(), targets.row(i).transpose());
+    }
+    update_weights();
+    return success;
+}
+
+void OnlineGPRModel::clear() {
+    m_size = 0;
+    m_weights.resize(0, kOutputSize);
+}
+
+int OnlineGPRModel::size() const {
+    return m_size;
+}
+
+int OnlineGPRModel::max_samples() const {
+    return m_max_samples;
+}
+
+bool OnlineGPRModel::add_sample(
+    const Eigen::VectorXd& input,
+    const Eigen::VectorXd& target) {
+    // A full window only drops its oldest sample once the new one is known
+    // to keep the factor positive definite
+    if (m_size == m_max_samples) {
+        if (remaining_variance(input) <= 0) {
+            return false;
+        }
+        remove_oldest_sample();
+    }
+    const int n = m_size;
+
+    // Extend L with [l^T d] where L l = k and d^2 = k(x, x) + noise - l.l
+    Eigen::VectorXd l(n);
+    if (n > 0) {
+        Eigen::MatrixXd covariance;
+        m_kernel->compute(m_inputs.topRows(n), input.transpose(), &covariance);
+        l = m_cholesky.topLeftCorner(n, n)
+            .triangularView<Eigen::Lower>().solve(covariance.col(0));
+    }
+    const double d2 = m_kernel->signal_variance() + m_noise_variance +
+        kJitter - l.squaredNorm();
+    if (d2 <= 0) {
+        return false;
+    }
+    m_cholesky.block(n, 0, 1, n) = l.transpose();
+    m_cholesky(n, n) = std::sqrt(d2);
+    m_inputs.row(n) = input.transpose();
+    m_targets.row(n) = target.transpose();
+    ++m_size;
+    return true;
+}
+
+double OnlineGPRModel::remaining_variance(
+    const Eigen::VectorXd& input) const {
+    const int n = m_size;
+
+    // With v = [0; k] and u = L^-1 e1, the covariance k of the input with
+    // all but the oldest sample satisfies
+    // k^T K22^-1 k = |L^-1 v|^2 - (u . L^-1 v)^2 / |u|^2
+    Eigen::VectorXd v = Eigen::VectorXd::Zero(n);
+    if (n > 1) {
+        Eigen::MatrixXd covariance;
+        m_kernel->compute(
+            m_inputs.block(1, 0, n - 1, kInputSize), input.transpose(),
+            &covariance);
+        v.tail(n - 1) = covariance.col(0);
+    }
+    const auto L =
+        m_cholesky.topLeftCorner(n, n).triangularView<Eigen::Lower>();
+    const Eigen::VectorXd a = L.solve(v);
+    const Eigen::VectorXd u = L.solve(Eigen::VectorXd::Unit(n, 0));
+    const double projection = u.dot(a);
+    return m_kernel->signal_variance() + m_noise_variance + kJitter -
+        a.squaredNorm() + projection * projection / u.squaredNorm();
+}
+
+void OnlineGPRModel::remove_oldest_sample() {
+    const int n = m_size;
+
+    // With L = [l11 0; l21 L22], the factor of the remaining samples is the
+    // rank-one update of L22 by l21: L22' L22'^T = L22 L22^T + l21 l21^T
+    Eigen::VectorXd x = m_cholesky.block(1, 0, n - 1, 1);
+    for (int k = 1; k < n; ++k) {
+        const int i = k - 1;
+        const double l_kk = m_cholesky(k, k);
+        const double r = std::hypot(l_kk, x[i]);
+        const double c = r / l_kk;
+        const double s = x[i] / l_kk;
+        m_cholesky(k, k) = r;
+        const int rest = n - k - 1;
+        if (rest > 0) {
+            auto column = m_cholesky.block(k + 1, k, rest, 1);
+            auto x_rest = x.segment(i + 1, rest);
+            column = (column + s * x_rest) / c;
+            x_rest = c * x_rest - s * column;
+        }
+    }
+
+    // Shift the remaining samples to the front
+    for (int j = 0; j < n - 1; ++j) {
+        m_cholesky.block(j, j, n - 1 - j, 1) =
+            m_cholesky.block(j + 1, j + 1, n - 1 - j, 1);
+    }
+    m_inputs.topRows(n - 1) = m_inputs.block(1, 0, n - 1, kInputSize).eval();
+    m_targets.topRows(n - 1) =
+        m_targets.block(1, 0, n - 1, kOutputSize).eval();
+    --m_size;
+}
+
+void OnlineGPRModel::update_weights() {
+    const auto L =
+        m_cholesky.topLeftCorner(m_size, m_size).triangularView<Eigen::Lower>();
+    m_weights = L.solve(m_targets.topRows(m_size));
+    L.transpose().solveInPlace(m_weights);
+}
+
+bool OnlineGPRModel::predict_targets(
+    const Eigen::MatrixXd& inputs,
+    Eigen::MatrixXd* means,
+    Eigen::MatrixXd* variances) const {
+    if (m_size == 0 || inputs.cols() != kInputSize) {
+        return false;
+    }
+
+    Eigen::MatrixXd K_s;
+    m_kernel->compute(inputs, m_inputs.topRows(m_size), &K_s);
+    *means = K_s * m_weights;
+    if (variances != nullptr) {
+        // k(x, x) - |L^-1 k|^2, shared by both outputs
+        const Eigen::MatrixXd V = m_cholesky.topLeftCorner(m_size, m_size)
+            .triangularView<Eigen::Lower>().solve(K_s.transpose());
+        const Eigen::VectorXd variance = (m_kernel->signal_variance() -
+            V.colwise().squaredNorm().transpose().array()).max(0.0).matrix();
+        *variances = variance.replicate(1, kOutputSize);
+    }
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
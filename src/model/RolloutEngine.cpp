@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/RolloutEngine.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace libcozmo {
+namespace model {
+
+RolloutEngine::RolloutEngine(
+    const std::shared_ptr<Model> model,
+    const actionspace::ActionSpace& actionspace,
+    const int& num_threads) :
+    m_model(model),
+    m_pool(new utils::ThreadPool(num_threads)) {
+    if (!m_model) {
+        throw std::invalid_argument("[RolloutEngine] Null model given");
+    }
+    if (actionspace.size() <= 0) {
+        throw std::invalid_argument("[RolloutEngine] Empty action space");
+    }
+    for (int i = 0; i < actionspace.size(); ++i) {
+        const Eigen::VectorXd action = actionspace.get_action(i)->vector();
+        if (i == 0) {
+            m_action_vectors.resize(actionspace.size(), action.size());
+        }
+        m_action_vectors.row(i) = action.transpose();
+    }
+}
+
+bool RolloutEngine::rollout(
+    const Eigen::VectorXd& start_state,
+    const Eigen::MatrixXi& action_ids,
+    Rollouts* rollouts) const {
+    return rollout_from_states(
+        start_state.transpose().replicate(action_ids.rows(), 1),
+        action_ids,
+        rollouts);
+}
+
+bool RolloutEngine::rollout_from_states(
+    const Eigen::MatrixXd& start_states,
+    const Eigen::MatrixXi& action_ids,
+    Rollouts* rollouts) const {
+    if (start_states.rows() != action_ids.rows() ||
+        (action_ids.size() > 0 && (
+            action_ids.minCoeff() < 0 ||
+            action_ids.maxCoeff() >= m_action_vectors.rows()))) {
+        return false;
+    }
+
+    const int num_sequences = action_ids.rows();
+    rollouts->num_sequences = num_sequences;
+    rollouts->horizon = action_ids.cols();
+    rollouts->state_size = start_states.cols();
+    rollouts->data.resize(
+        num_sequences, (action_ids.cols() + 1) * start_states.cols());
+    rollouts->timestep(0) = start_states;
+    if (num_sequences == 0 || action_ids.cols() == 0) {
+        return true;
+    }
+
+    if (!m_model->is_thread_safe()) {
+        return rollout_chunk(action_ids, 0, num_sequences, rollouts);
+    }
+
+    const int num_chunks = std::min(num_sequences, m_pool->size() + 1);
+    std::vector<char> success(num_chunks, 0);
+    m_pool->parallel_for(num_chunks, [&](int chunk) {
+        const int begin =
+            static_cast<long>(num_sequences) * chunk / num_chunks;
+        const int end =
+            static_cast<long>(num_sequences) * (chunk + 1) / num_chunks;
+        success[chunk] = rollout_chunk(action_ids, begin, end, rollouts);
+    });
+    return std::all_of(
+        success.begin(), success.end(), [](char s) { return s != 0; });
+}
+
+const Eigen::MatrixXd& RolloutEngine::action_vectors() const {
+    return m_action_vectors;
+}
+
+bool RolloutEngine::rollout_chunk(
+    const Eigen::MatrixXi& action_ids,
+    const int& begin,
+    const int& end,
+    Rollouts* rollouts) const {
+    const int size = end - begin;
+    const int state_size = rollouts->state_size;
+    Eigen::MatrixXd states = rollouts->timestep(0).middleRows(begin, size);
+    Eigen::MatrixXd actions(size, m_action_vectors.cols());
+    Eigen::MatrixXd next_states;
+
+    for (int t = 0; t < rollouts->horizon; ++t) {
+        for (int i = 0; i < size; ++i) {
+            actions.row(i) = m_action_vectors.row(action_ids(begin + i, t));
+        }
+        if (!m_model->predict_states(actions, states, &next_states) ||
+            next_states.rows() != size || next_states.cols() != state_size) {
+            return false;
+        }
+        rollouts->timestep(t + 1).middleRows(begin, size) = next_states;
+        states.swap(next_states);
+    }
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
@@ -53,7 +53,13 @@ bool ScikitLearnFramework::initialize(const std::string& model_path) {
         << "def load_model(filename):" << std::endl
         << "    return pickle.load(open(filename, 'rb'))" << std::endl
         << "def inference(model, input):" << std::endl
-        << "    return model.predict(input).tolist()[0]" << std::endl;
+        << "    return model.predict(input).tolist()[0]" << std::endl
+        << "def batch_inference(model, input):" << std::endl
+        << "    return model.predict(input).tolist()" << std::endl
+        << "def batch_inference_with_std(model, input):" << std::endl
+        << "    mean, std = model.predict(input, return_std=True)" << std::endl
+        << "    return (mean.tolist(), " << std::endl
+        << "            std.reshape(len(input), -1).tolist())" << std::endl;
 
     // Compile python code
     PyObject* p_compiled_fn =
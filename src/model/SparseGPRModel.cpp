@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/SparseGPRModel.hpp"
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace libcozmo {
+namespace model {
+
+/// Jitter added to the diagonal of the inducing point covariance matrix for
+/// numerical stability
+static const double kJitter = 1e-8;
+
+SparseGPRModel::SparseGPRModel(
+    const std::shared_ptr<Kernel> kernel,
+    const double& noise_variance) : \
+    m_kernel(kernel),
+    m_noise_variance(noise_variance) {
+    if (m_kernel == nullptr) {
+        throw std::invalid_argument("[SparseGPRModel] kernel is a nullptr");
+    }
+    if (m_noise_variance < 0) {
+        throw std::invalid_argument(
+            "[SparseGPRModel] noise variance must be non-negative");
+    }
+}
+
+bool SparseGPRModel::train(
+    const Dataset& dataset,
+    const int& num_inducing_points,
+    const unsigned int& seed) {
+    if (num_inducing_points <= 0 || dataset.size() == 0) {
+        return false;
+    }
+    const Eigen::MatrixXd inputs = get_inputs(dataset.actions());
+    const Eigen::MatrixXd targets =
+        get_targets(dataset.start_states(), dataset.end_states());
+
+    std::vector<int> indices(inputs.rows());
+    std::iota(indices.begin(), indices.end(), 0);
+    std::mt19937 generator(seed);
+    std::shuffle(indices.begin(), indices.end(), generator);
+
+    const int num_points =
+        std::min(num_inducing_points, static_cast<int>(inputs.rows()));
+    Eigen::MatrixXd inducing_points(num_points, inputs.cols());
+    for (int i = 0; i < num_points; ++i) {
+        inducing_points.row(i) = inputs.row(indices[i]);
+    }
+    return train(inputs, targets, inducing_points);
+}
+
+bool SparseGPRModel::train(
+    const Eigen::MatrixXd& inputs,
+    const Eigen::MatrixXd& targets,
+    const Eigen::MatrixXd& inducing_points) {
+    if (inputs.rows() != targets.rows() || inputs.rows() == 0 ||
+        inducing_points.rows() == 0 ||
+        inputs.cols() != inducing_points.cols()) {
+        return false;
+    }
+    const int m = inducing_points.rows();
+
+    // Kmm = Lm Lm^T
+    Eigen::MatrixXd K_mm;
+    m_kernel->compute(inducing_points, inducing_points, &K_mm);
+    K_mm.diagonal().array() += kJitter * m_kernel->signal_variance();
+    const Eigen::LLT<Eigen::MatrixXd> llt_mm(K_mm);
+    if (llt_mm.info() != Eigen::Success) {
+        return false;
+    }
+
+    // V = Lm^-1 Kmn, so Qnn = V^T V
+    Eigen::MatrixXd V;
+    m_kernel->compute(inducing_points, inputs, &V);
+    llt_mm.matrixL().solveInPlace(V);
+
+    // FITC replaces the diagonal of Qnn with the exact prior variance:
+    // Λ = diag(Knn - Qnn) + noise
+    const Eigen::ArrayXd lambda =
+        (m_kernel->signal_variance() - V.colwise().squaredNorm().array())
+            .max(0.0) + m_noise_variance + kJitter;
+    const Eigen::MatrixXd V_scaled =
+        V * lambda.sqrt().inverse().matrix().asDiagonal();
+
+    // A = I + V Λ^-1 V^T = La La^T
+    Eigen::MatrixXd A = Eigen::MatrixXd::Identity(m, m);
+    A.selfadjointView<Eigen::Lower>().rankUpdate(V_scaled);
+    const Eigen::LLT<Eigen::MatrixXd> llt_a(A);
+    if (llt_a.info() != Eigen::Success) {
+        return false;
+    }
+
+    // Predictive mean weights: Lm^-T A^-1 V Λ^-1 y
+    const Eigen::MatrixXd scaled_targets =
+        lambda.inverse().matrix().asDiagonal() * targets;
+    m_weights = llt_a.solve(V * scaled_targets);
+    llt_mm.matrixU().solveInPlace(m_weights);
+
+    // Predictive variance weights: Kmm^-1 - Σ = Lm^-T (I - A^-1) Lm^-1
+    Eigen::MatrixXd inner = Eigen::MatrixXd::Identity(m, m) -
+        llt_a.solve(Eigen::MatrixXd::Identity(m, m));
+    llt_mm.matrixU().solveInPlace(inner);
+    m_variance_weights = inner.transpose();
+    llt_mm.matrixU().solveInPlace(m_variance_weights);
+
+    m_inducing_points = inducing_points;
+    return true;
+}
+
+bool SparseGPRModel::is_trained() const {
+    return m_inducing_points.rows() > 0;
+}
+
+const Eigen::MatrixXd& SparseGPRModel::inducing_points() const {
+    return m_inducing_points;
+}
+
+bool SparseGPRModel::predict_targets(
+    const Eigen::MatrixXd& inputs,
+    Eigen::MatrixXd* means,
+    Eigen::MatrixXd* variances) const {
+    if (!is_trained() || inputs.cols() != m_inducing_points.cols()) {
+        return false;
+    }
+
+    Eigen::MatrixXd K_sm;
+    m_kernel->compute(inputs, m_inducing_points, &K_sm);
+    *means = K_sm * m_weights;
+    if (variances != nullptr) {
+        // Both outputs share the kernel so they have the same variance
+        const Eigen::VectorXd variance = (m_kernel->signal_variance() -
+            (K_sm * m_variance_weights).cwiseProduct(K_sm)
+                .rowwise().sum().array()).max(0.0).matrix();
+        *variances = variance.replicate(1, kOutputSize);
+    }
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
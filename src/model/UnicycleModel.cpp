@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "model/UnicycleModel.hpp"
+#include <cmath>
+#include "utils/utils.hpp"
+
+namespace libcozmo {
+namespace model {
+
+bool UnicycleModel::predict_state(
+    const Eigen::VectorXd& input_action,
+    const Eigen::VectorXd& input_state,
+    Eigen::VectorXd* output_state) const {
+    if (input_action.size() != 3 || input_state.size() != 3) {
+        return false;
+    }
+    const double distance = input_action[0] * input_action[1];
+    const double theta =
+        utils::angle_normalization(input_state[2] + input_action[2]);
+    *output_state = Eigen::Vector3d(
+        input_state[0] + distance * cos(theta),
+        input_state[1] + distance * sin(theta),
+        theta);
+    return true;
+}
+
+bool UnicycleModel::predict_states(
+    const Eigen::MatrixXd& input_actions,
+    const Eigen::MatrixXd& input_states,
+    Eigen::MatrixXd* output_states) const {
+    if (input_actions.cols() != 3 || input_states.cols() != 3 ||
+        input_actions.rows() != input_states.rows()) {
+        return false;
+    }
+
+    // Columns of the (column major) inputs are contiguous so every
+    // expression below runs over packets of samples
+    const Eigen::ArrayXd distance =
+        input_actions.col(0).array() * input_actions.col(1).array();
+    Eigen::ArrayXd theta =
+        input_states.col(2).array() + input_actions.col(2).array();
+    theta -= 2.0 * M_PI * (theta / (2.0 * M_PI)).floor();
+
+    output_states->resize(input_states.rows(), 3);
+    output_states->col(0) =
+        (input_states.col(0).array() + distance * theta.cos()).matrix();
+    output_states->col(1) =
+        (input_states.col(1).array() + distance * theta.sin()).matrix();
+    output_states->col(2) = theta.matrix();
+    return true;
+}
+
+}  // namespace model
+}  // namespace libcozmo
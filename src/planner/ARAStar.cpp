@@ -0,0 +1,267 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "planner/ARAStar.hpp"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace planner {
+
+ARAStar::ARAStar(
+    const std::shared_ptr<statespace::SE2> statespace,
+    const std::shared_ptr<actionspace::ActionSpace> actionspace,
+    const std::shared_ptr<model::Model> model,
+    const std::shared_ptr<distance::Distance> distance,
+    const Parameters& parameters) :
+    m_successors(statespace, actionspace, model),
+    m_statespace(statespace),
+    m_distance(distance),
+    m_parameters(parameters),
+    m_start_id(-1),
+    m_goal_id(-1),
+    m_epsilon(parameters.initial_epsilon),
+    m_search_completed(false),
+    m_bound(std::numeric_limits<double>::infinity()),
+    m_bound_cost(0) {
+    if (m_distance == nullptr) {
+        throw std::invalid_argument("[ARAStar] Null distance given");
+    }
+    if (m_parameters.final_epsilon < 1.0 ||
+        m_parameters.initial_epsilon < m_parameters.final_epsilon) {
+        throw std::invalid_argument(
+            "[ARAStar] Epsilons must satisfy initial >= final >= 1");
+    }
+    if (m_parameters.epsilon_step <= 0) {
+        throw std::invalid_argument("[ARAStar] Epsilon step is not positive");
+    }
+}
+
+bool ARAStar::solve(
+    const statespace::SE2::State& start,
+    const statespace::SE2::State& goal,
+    const double& time_budget,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    const auto start_time = Clock::now();
+    m_table.reset();
+    m_table.reserve(m_statespace->size());
+    m_open.clear();
+    for (const int& state_id : m_incons) {
+        m_in_incons[state_id] = false;
+    }
+    m_incons.clear();
+    m_statistics = Statistics();
+    m_goal = goal;
+    m_goal_id = -1;
+    m_epsilon = m_parameters.initial_epsilon;
+    m_search_completed = false;
+    m_bound = std::numeric_limits<double>::infinity();
+    m_bound_cost = 0;
+
+    m_start_id = m_statespace->get_or_create_state(start);
+    m_table.set_g(m_start_id, 0);
+    if (heuristic(m_start_id) <= m_parameters.goal_tolerance) {
+        m_goal_id = m_start_id;
+    } else {
+        m_open.push(m_start_id, key(m_start_id));
+    }
+    return run(start_time, time_budget, actions, states);
+}
+
+bool ARAStar::improve(
+    const double& time_budget,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    if (m_start_id < 0) {
+        return false;
+    }
+    return run(Clock::now(), time_budget, actions, states);
+}
+
+bool ARAStar::is_finished() const {
+    return m_search_completed && m_epsilon <= m_parameters.final_epsilon;
+}
+
+const ARAStar::Statistics& ARAStar::get_statistics() const {
+    return m_statistics;
+}
+
+bool ARAStar::run(
+    const Clock::time_point& start_time,
+    const double& time_budget,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    const bool has_deadline = time_budget > 0;
+    const Clock::time_point end = start_time +
+        std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(time_budget));
+    while (true) {
+        if (!m_search_completed) {
+            if (!improve_path(has_deadline, end)) {
+                break;
+            }
+            m_search_completed = true;
+            ++m_statistics.num_searches;
+            m_statistics.epsilon = m_epsilon;
+            if (m_goal_id >= 0) {
+                m_statistics.solution_costs.push_back(m_table.g(m_goal_id));
+                m_bound = suboptimality_bound();
+                m_bound_cost = m_table.g(m_goal_id);
+            }
+        }
+        if (m_epsilon <= m_parameters.final_epsilon ||
+            (has_deadline && Clock::now() >= end)) {
+            break;
+        }
+        m_epsilon = std::max(
+            m_parameters.final_epsilon,
+            m_epsilon - m_parameters.epsilon_step);
+        prepare_search();
+        m_search_completed = false;
+    }
+    m_statistics.seconds +=
+        std::chrono::duration<double>(Clock::now() - start_time).count();
+
+    actions->clear();
+    if (states != nullptr) {
+        states->clear();
+    }
+    if (m_goal_id < 0) {
+        return false;
+    }
+    m_statistics.path_cost = m_table.g(m_goal_id);
+    // A search interrupted by the deadline may only have lowered the cost
+    // since the bound of the last completed search was computed
+    m_statistics.suboptimality_bound = m_bound_cost > 0 ?
+        m_bound * m_statistics.path_cost / m_bound_cost : m_bound;
+    m_table.extract_path(m_goal_id, actions, states);
+    return true;
+}
+
+bool ARAStar::improve_path(
+    const bool& has_deadline, const Clock::time_point& end) {
+    std::vector<SE2Successors::Successor> successors;
+    while (!m_open.empty()) {
+        if (m_goal_id >= 0 &&
+            m_table.g(m_goal_id) <= m_open.top_key().first) {
+            return true;
+        }
+        if (has_deadline && Clock::now() >= end) {
+            return false;
+        }
+        const int state_id = m_open.pop();
+        m_table.set_closed(state_id);
+        ++m_statistics.num_expansions;
+
+        if (!m_successors.get_successors(state_id, &successors)) {
+            continue;
+        }
+        const auto state = m_statespace->get_state(state_id);
+        const double g = m_table.g(state_id);
+        for (const auto& successor : successors) {
+            const int next_id = successor.state_id;
+            const double cost =
+                g + m_distance->get_distance(*state, successor.state);
+            if (!(cost < m_table.g(next_id))) {
+                continue;
+            }
+            m_table.set_g(next_id, cost);
+            m_table.set_parent(next_id, state_id, successor.action_id);
+            if (heuristic(next_id) <= m_parameters.goal_tolerance) {
+                // Goals are not expanded; remember the cheapest one
+                if (m_goal_id < 0 || cost < m_table.g(m_goal_id)) {
+                    m_goal_id = next_id;
+                }
+            } else if (!m_table.closed(next_id)) {
+                m_open.push(next_id, key(next_id));
+            } else if (!is_incons(next_id)) {
+                if (next_id >= static_cast<int>(m_in_incons.size())) {
+                    m_in_incons.resize(m_table.size(), false);
+                }
+                m_in_incons[next_id] = true;
+                m_incons.push_back(next_id);
+            }
+        }
+    }
+    return true;
+}
+
+void ARAStar::prepare_search() {
+    for (const int& state_id : m_incons) {
+        m_in_incons[state_id] = false;
+        m_open.push(state_id, key(state_id));
+    }
+    m_incons.clear();
+    m_open.rekey([this](const int& state_id) { return key(state_id); });
+    m_table.reset_closed();
+}
+
+double ARAStar::suboptimality_bound() const {
+    // Any state on an optimal path that is not settled is in OPEN or
+    // INCONS, so the smallest g + h over them bounds the optimal cost
+    double lower_bound = std::numeric_limits<double>::infinity();
+    m_open.for_each([this, &lower_bound](const int& state_id, const Key&) {
+        lower_bound = std::min(
+            lower_bound, m_table.g(state_id) + m_table.h(state_id));
+    });
+    for (const int& state_id : m_incons) {
+        lower_bound = std::min(
+            lower_bound, m_table.g(state_id) + m_table.h(state_id));
+    }
+    const double cost = m_table.g(m_goal_id);
+    if (cost <= lower_bound) {
+        return 1.0;
+    }
+    return std::min(m_statistics.epsilon, cost / lower_bound);
+}
+
+ARAStar::Key ARAStar::key(const int& state_id) {
+    const double h = heuristic(state_id);
+    return Key(m_table.g(state_id) + m_epsilon * h, h);
+}
+
+bool ARAStar::is_incons(const int& state_id) const {
+    return state_id < static_cast<int>(m_in_incons.size()) &&
+        m_in_incons[state_id];
+}
+
+double ARAStar::heuristic(const int& state_id) {
+    double h = m_table.h(state_id);
+    if (h < 0) {
+        h = m_distance->get_distance(
+            *m_statespace->get_state(state_id), m_goal);
+        m_table.set_h(state_id, h);
+    }
+    return h;
+}
+
+}  // namespace planner
+}  // namespace libcozmo
@@ -0,0 +1,279 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "planner/LPAStar.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace planner {
+
+namespace {
+
+const double kInfinity = std::numeric_limits<double>::infinity();
+
+}  // namespace
+
+LPAStar::LPAStar(
+    const std::shared_ptr<statespace::SE2> statespace,
+    const std::shared_ptr<actionspace::ActionSpace> actionspace,
+    const std::shared_ptr<model::Model> model,
+    const std::shared_ptr<distance::Distance> distance) :
+    m_successors(statespace, actionspace, model),
+    m_statespace(statespace),
+    m_distance(distance),
+    m_start_id(-1),
+    m_goal_id(-1) {
+    if (m_distance == nullptr) {
+        throw std::invalid_argument("[LPAStar] Null distance given");
+    }
+}
+
+bool LPAStar::solve(
+    const statespace::SE2::State& start,
+    const statespace::SE2::State& goal,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    for (auto& state_node : m_nodes) {
+        state_node.g = kInfinity;
+        state_node.rhs = kInfinity;
+    }
+    m_open.clear();
+    set_goal(goal);
+    m_start_id = m_statespace->get_or_create_state(start);
+    node(m_start_id).rhs = 0;
+    m_open.push(m_start_id, key(m_start_id));
+    return replan(actions, states);
+}
+
+bool LPAStar::replan(std::vector<int>* actions, std::vector<int>* states) {
+    const auto start_time = std::chrono::steady_clock::now();
+    m_statistics = Statistics();
+    actions->clear();
+    if (states != nullptr) {
+        states->clear();
+    }
+    if (m_start_id < 0) {
+        return false;
+    }
+    compute_shortest_path();
+    const bool found = extract_path(actions, states);
+    m_statistics.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_time).count();
+    return found;
+}
+
+void LPAStar::set_goal(const statespace::SE2::State& goal) {
+    m_goal = goal;
+    m_goal_id = m_statespace->get_or_create_state(goal);
+    node(m_goal_id);
+    // Start distances do not depend on the goal; only the priorities do
+    for (auto& state_node : m_nodes) {
+        state_node.h = -1.0;
+    }
+    m_open.rekey([this](const int& state_id) { return key(state_id); });
+}
+
+void LPAStar::set_edge_cost(
+    const int& state_id, const int& action_id, const double& cost) {
+    const auto edge_key = std::make_pair(state_id, action_id);
+    if (cost < 0) {
+        m_edge_costs.erase(edge_key);
+    } else {
+        m_edge_costs[edge_key] = cost;
+    }
+    if (state_id < 0 || state_id >= static_cast<int>(m_nodes.size())) {
+        return;
+    }
+    for (const int& edge_id : m_nodes[state_id].successors) {
+        Edge& edge = m_edges[edge_id];
+        if (edge.action == action_id) {
+            edge.cost = edge_cost(edge.source, edge.target, edge.action);
+            if (m_start_id >= 0) {
+                update_state(edge.target);
+            }
+        }
+    }
+}
+
+void LPAStar::set_state_validity(const int& state_id, const bool& valid) {
+    if (state_id < 0) {
+        return;
+    }
+    node(state_id).valid = valid;
+    if (m_start_id >= 0) {
+        update_state(state_id);
+    }
+}
+
+const LPAStar::Statistics& LPAStar::get_statistics() const {
+    return m_statistics;
+}
+
+LPAStar::Node& LPAStar::node(const int& state_id) {
+    if (state_id >= static_cast<int>(m_nodes.size())) {
+        m_nodes.resize(state_id + 1, Node{
+            kInfinity, kInfinity, -1.0, true, false, {}, {}});
+    }
+    return m_nodes[state_id];
+}
+
+double LPAStar::heuristic(const int& state_id) {
+    Node& state_node = node(state_id);
+    if (state_node.h < 0) {
+        state_node.h = m_distance->get_distance(
+            *m_statespace->get_state(state_id), m_goal);
+    }
+    return state_node.h;
+}
+
+LPAStar::Key LPAStar::key(const int& state_id) {
+    const Node& state_node = node(state_id);
+    const double g = std::min(state_node.g, state_node.rhs);
+    return Key(g + heuristic(state_id), g);
+}
+
+double LPAStar::edge_cost(
+    const int& source, const int& target, const int& action) const {
+    const auto found = m_edge_costs.find(std::make_pair(source, action));
+    if (found != m_edge_costs.end()) {
+        return found->second;
+    }
+    return m_distance->get_distance(
+        *m_statespace->get_state(source), *m_statespace->get_state(target));
+}
+
+void LPAStar::expand(const int& state_id) {
+    if (node(state_id).expanded) {
+        return;
+    }
+    node(state_id).expanded = true;
+    ++m_statistics.num_model_calls;
+    std::vector<SE2Successors::Successor> successors;
+    if (!m_successors.get_successors(state_id, &successors)) {
+        return;
+    }
+    for (const auto& successor : successors) {
+        const int edge_id = m_edges.size();
+        m_edges.push_back(Edge{
+            state_id,
+            successor.state_id,
+            successor.action_id,
+            edge_cost(state_id, successor.state_id, successor.action_id)});
+        node(successor.state_id).predecessors.push_back(edge_id);
+        m_nodes[state_id].successors.push_back(edge_id);
+    }
+}
+
+void LPAStar::update_state(const int& state_id) {
+    Node& state_node = node(state_id);
+    if (state_id != m_start_id) {
+        state_node.rhs = kInfinity;
+        if (state_node.valid) {
+            for (const int& edge_id : state_node.predecessors) {
+                const Edge& edge = m_edges[edge_id];
+                state_node.rhs = std::min(
+                    state_node.rhs, m_nodes[edge.source].g + edge.cost);
+            }
+        }
+    }
+    if (state_node.g != state_node.rhs) {
+        m_open.push(state_id, key(state_id));
+    } else {
+        m_open.erase(state_id);
+    }
+}
+
+void LPAStar::compute_shortest_path() {
+    while (!m_open.empty() && (
+            m_open.top_key() < key(m_goal_id) ||
+            m_nodes[m_goal_id].rhs != m_nodes[m_goal_id].g)) {
+        const int state_id = m_open.pop();
+        ++m_statistics.num_expansions;
+        expand(state_id);
+        Node& state_node = m_nodes[state_id];
+        if (state_node.g > state_node.rhs) {
+            state_node.g = state_node.rhs;
+        } else {
+            state_node.g = kInfinity;
+            update_state(state_id);
+        }
+        for (const int& edge_id : m_nodes[state_id].successors) {
+            update_state(m_edges[edge_id].target);
+        }
+    }
+}
+
+bool LPAStar::extract_path(
+    std::vector<int>* actions, std::vector<int>* states) {
+    if (m_nodes[m_goal_id].g == kInfinity) {
+        return false;
+    }
+    m_statistics.path_cost = m_nodes[m_goal_id].g;
+    int state_id = m_goal_id;
+    if (states != nullptr) {
+        states->push_back(state_id);
+    }
+    while (state_id != m_start_id) {
+        // The best predecessor of a consistent state is on a shortest path
+        int best_edge = -1;
+        double best_cost = kInfinity;
+        for (const int& edge_id : m_nodes[state_id].predecessors) {
+            const Edge& edge = m_edges[edge_id];
+            const double cost = m_nodes[edge.source].g + edge.cost;
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_edge = edge_id;
+            }
+        }
+        if (best_edge < 0 || actions->size() >= m_nodes.size()) {
+            actions->clear();
+            if (states != nullptr) {
+                states->clear();
+            }
+            return false;
+        }
+        state_id = m_edges[best_edge].source;
+        actions->push_back(m_edges[best_edge].action);
+        if (states != nullptr) {
+            states->push_back(state_id);
+        }
+    }
+    std::reverse(actions->begin(), actions->end());
+    if (states != nullptr) {
+        std::reverse(states->begin(), states->end());
+    }
+    return true;
+}
+
+}  // namespace planner
+}  // namespace libcozmo
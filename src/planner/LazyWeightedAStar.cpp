@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "planner/LazyWeightedAStar.hpp"
+#include <chrono>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace planner {
+
+LazyWeightedAStar::LazyWeightedAStar(
+    const std::shared_ptr<statespace::SE2> statespace,
+    const std::shared_ptr<actionspace::ActionSpace> actionspace,
+    const std::shared_ptr<model::Model> model,
+    const std::shared_ptr<model::Model> estimate_model,
+    const std::shared_ptr<distance::Distance> distance,
+    const Parameters& parameters) :
+    m_successors(statespace, actionspace, model),
+    m_estimates(statespace, actionspace, estimate_model),
+    m_statespace(statespace),
+    m_distance(distance),
+    m_parameters(parameters),
+    m_num_actions(m_successors.num_actions()) {
+    if (m_distance == nullptr) {
+        throw std::invalid_argument("[LazyWeightedAStar] Null distance given");
+    }
+    if (m_parameters.weight < 1.0) {
+        throw std::invalid_argument(
+            "[LazyWeightedAStar] Weight is less than 1");
+    }
+}
+
+bool LazyWeightedAStar::solve(
+    const statespace::SE2::State& start,
+    const statespace::SE2::State& goal,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    const auto start_time = std::chrono::steady_clock::now();
+    m_statistics = Statistics();
+    m_table.reset();
+    m_table.reserve(m_statespace->size());
+    m_open.clear();
+    m_lazy_edges.clear();
+    actions->clear();
+    if (states != nullptr) {
+        states->clear();
+    }
+
+    const int start_id = m_statespace->get_or_create_state(start);
+    m_table.set_g(start_id, 0);
+    const double start_h = heuristic(start_id, goal);
+    m_open.push(
+        state_entry(start_id), Key(m_parameters.weight * start_h, start_h));
+
+    int goal_id = -1;
+    while (!m_open.empty()) {
+        const int entry = m_open.pop();
+        const int state_id = entry / (m_num_actions + 1);
+        const int action_id = entry % (m_num_actions + 1) - 1;
+        if (action_id >= 0) {
+            evaluate(state_id, action_id, goal);
+            continue;
+        }
+        if (heuristic(state_id, goal) <= m_parameters.goal_tolerance) {
+            goal_id = state_id;
+            break;
+        }
+        if (m_parameters.max_expansions > 0 &&
+            m_statistics.num_expansions >= m_parameters.max_expansions) {
+            break;
+        }
+        expand(state_id, goal);
+    }
+
+    if (goal_id >= 0) {
+        m_statistics.path_cost = m_table.g(goal_id);
+        m_table.extract_path(goal_id, actions, states);
+    }
+    m_statistics.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_time).count();
+    return goal_id >= 0;
+}
+
+const LazyWeightedAStar::Statistics&
+LazyWeightedAStar::get_statistics() const {
+    return m_statistics;
+}
+
+const LazyWeightedAStar::Parameters&
+LazyWeightedAStar::get_parameters() const {
+    return m_parameters;
+}
+
+double LazyWeightedAStar::heuristic(
+    const int& state_id, const statespace::SE2::State& goal) {
+    double h = m_table.h(state_id);
+    if (h < 0) {
+        h = m_distance->get_distance(*m_statespace->get_state(state_id), goal);
+        m_table.set_h(state_id, h);
+    }
+    return h;
+}
+
+int LazyWeightedAStar::state_entry(const int& state_id) const {
+    return state_id * (m_num_actions + 1);
+}
+
+int LazyWeightedAStar::edge_entry(
+    const int& state_id, const int& action_id) const {
+    return state_id * (m_num_actions + 1) + action_id + 1;
+}
+
+bool LazyWeightedAStar::is_dominated(const LazyEdge& edge) const {
+    int successor_id;
+    if (!m_statespace->get_state_id(edge.successor, &successor_id)) {
+        return false;
+    }
+    return m_table.closed(successor_id) || m_table.g(successor_id) <= edge.g;
+}
+
+void LazyWeightedAStar::expand(
+    const int& state_id, const statespace::SE2::State& goal) {
+    m_table.set_closed(state_id);
+    ++m_statistics.num_expansions;
+    const auto& state = *static_cast<const statespace::SE2::State*>(
+        m_statespace->get_state(state_id));
+    if (!m_estimates.predict_successors(state, &m_estimated_states)) {
+        return;
+    }
+    const double g = m_table.g(state_id);
+    for (int i = 0; i < m_num_actions; ++i) {
+        ++m_statistics.num_estimates;
+        const LazyEdge edge{
+            m_estimated_states[i],
+            g + m_distance->get_distance(state, m_estimated_states[i])};
+        if (m_parameters.prune_estimates && is_dominated(edge)) {
+            ++m_statistics.num_pruned;
+            continue;
+        }
+        const double h = m_distance->get_distance(edge.successor, goal);
+        m_open.push(
+            edge_entry(state_id, i),
+            Key(edge.g + m_parameters.weight * h, h));
+        m_lazy_edges[edge_entry(state_id, i)] = edge;
+    }
+}
+
+void LazyWeightedAStar::evaluate(
+    const int& state_id,
+    const int& action_id,
+    const statespace::SE2::State& goal) {
+    const auto edge = m_lazy_edges.find(edge_entry(state_id, action_id));
+    // Other edges may have reached the successor while this one was queued
+    const bool dominated =
+        m_parameters.prune_estimates && is_dominated(edge->second);
+    m_lazy_edges.erase(edge);
+    if (dominated) {
+        ++m_statistics.num_pruned;
+        return;
+    }
+    ++m_statistics.num_evaluations;
+    int successor_id;
+    if (!m_successors.get_successor(state_id, action_id, &successor_id) ||
+        successor_id == state_id) {
+        return;
+    }
+    if (m_table.closed(successor_id)) {
+        return;
+    }
+    const double cost = m_table.g(state_id) + m_distance->get_distance(
+        *m_statespace->get_state(state_id),
+        *m_statespace->get_state(successor_id));
+    if (cost < m_table.g(successor_id)) {
+        m_table.set_g(successor_id, cost);
+        m_table.set_parent(successor_id, state_id, action_id);
+        const double h = heuristic(successor_id, goal);
+        m_open.push(
+            state_entry(successor_id),
+            Key(cost + m_parameters.weight * h, h));
+    }
+}
+
+}  // namespace planner
+}  // namespace libcozmo
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "planner/MHAStar.hpp"
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace planner {
+
+MHAStar::MHAStar(
+    const std::shared_ptr<statespace::SE2> statespace,
+    const std::shared_ptr<actionspace::ActionSpace> actionspace,
+    const std::shared_ptr<model::Model> model,
+    const std::shared_ptr<distance::Distance> distance,
+    const std::vector<std::shared_ptr<distance::Distance>>& heuristics,
+    const Parameters& parameters) :
+    m_successors(statespace, actionspace, model),
+    m_statespace(statespace),
+    m_distance(distance),
+    m_heuristics(heuristics),
+    m_parameters(parameters),
+    m_goal_id(-1),
+    m_open(heuristics.size() + 1) {
+    if (m_distance == nullptr) {
+        throw std::invalid_argument("[MHAStar] Null distance given");
+    }
+    if (m_heuristics.empty()) {
+        throw std::invalid_argument("[MHAStar] No inadmissible heuristic");
+    }
+    for (const auto& heuristic : m_heuristics) {
+        if (heuristic == nullptr) {
+            throw std::invalid_argument("[MHAStar] Null heuristic given");
+        }
+    }
+    if (m_parameters.heuristic_weight < 1.0 ||
+        m_parameters.anchor_weight < 1.0) {
+        throw std::invalid_argument("[MHAStar] Weight is less than 1");
+    }
+}
+
+bool MHAStar::solve(
+    const statespace::SE2::State& start,
+    const statespace::SE2::State& goal,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    const auto start_time = std::chrono::steady_clock::now();
+    m_statistics = Statistics();
+    m_statistics.queue_expansions.assign(m_open.size(), 0);
+    m_table.reset();
+    m_table.reserve(m_statespace->size());
+    for (auto& open : m_open) {
+        open.clear();
+    }
+    for (const int& state_id : m_closed_inadmissible) {
+        m_is_closed_inadmissible[state_id] = false;
+    }
+    m_closed_inadmissible.clear();
+    actions->clear();
+    if (states != nullptr) {
+        states->clear();
+    }
+    m_goal = goal;
+    m_goal_id = -1;
+
+    const int start_id = m_statespace->get_or_create_state(start);
+    m_table.set_g(start_id, 0);
+    if (heuristic(start_id) <= m_parameters.goal_tolerance) {
+        m_goal_id = start_id;
+    } else {
+        for (int i = 0; i < static_cast<int>(m_open.size()); ++i) {
+            m_open[i].push(start_id, key(start_id, i));
+        }
+    }
+
+    DaryHeap<Key>& anchor = m_open[0];
+    const int num_queues = m_open.size();
+    int queue = 0;
+    while (!anchor.empty()) {
+        if (m_goal_id >= 0 &&
+            m_table.g(m_goal_id) <= anchor.top_key().first) {
+            break;
+        }
+        if (m_parameters.max_expansions > 0 &&
+            m_statistics.num_expansions >= m_parameters.max_expansions) {
+            break;
+        }
+        // Round robin over the inadmissible open lists
+        queue = queue % (num_queues - 1) + 1;
+        const DaryHeap<Key>& open = m_open[queue];
+        if (!open.empty() && open.top_key().first <=
+                m_parameters.anchor_weight * anchor.top_key().first) {
+            if (m_goal_id >= 0 &&
+                m_table.g(m_goal_id) <= open.top_key().first) {
+                break;
+            }
+            expand(open.top(), queue);
+        } else {
+            expand(anchor.top(), 0);
+        }
+    }
+
+    if (m_goal_id >= 0) {
+        m_statistics.path_cost = m_table.g(m_goal_id);
+        m_table.extract_path(m_goal_id, actions, states);
+    }
+    m_statistics.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_time).count();
+    return m_goal_id >= 0;
+}
+
+const MHAStar::Statistics& MHAStar::get_statistics() const {
+    return m_statistics;
+}
+
+const MHAStar::Parameters& MHAStar::get_parameters() const {
+    return m_parameters;
+}
+
+MHAStar::Key MHAStar::key(const int& state_id, const int& queue) const {
+    const double h = queue == 0 ? m_table.h(state_id) :
+        m_heuristics[queue - 1]->get_distance(
+            *m_statespace->get_state(state_id), m_goal);
+    return Key(m_table.g(state_id) + m_parameters.heuristic_weight * h, h);
+}
+
+double MHAStar::heuristic(const int& state_id) {
+    double h = m_table.h(state_id);
+    if (h < 0) {
+        h = m_distance->get_distance(
+            *m_statespace->get_state(state_id), m_goal);
+        m_table.set_h(state_id, h);
+    }
+    return h;
+}
+
+bool MHAStar::is_closed_inadmissible(const int& state_id) const {
+    return state_id < static_cast<int>(m_is_closed_inadmissible.size()) &&
+        m_is_closed_inadmissible[state_id];
+}
+
+void MHAStar::expand(const int& state_id, const int& queue) {
+    for (auto& open : m_open) {
+        open.erase(state_id);
+    }
+    if (queue == 0) {
+        m_table.set_closed(state_id);
+    } else {
+        if (state_id >= static_cast<int>(m_is_closed_inadmissible.size())) {
+            m_is_closed_inadmissible.resize(m_table.size(), false);
+        }
+        m_is_closed_inadmissible[state_id] = true;
+        m_closed_inadmissible.push_back(state_id);
+    }
+    ++m_statistics.num_expansions;
+    ++m_statistics.queue_expansions[queue];
+
+    std::vector<SE2Successors::Successor> successors;
+    if (!m_successors.get_successors(state_id, &successors)) {
+        return;
+    }
+    const auto state = m_statespace->get_state(state_id);
+    const double g = m_table.g(state_id);
+    for (const auto& successor : successors) {
+        const int next_id = successor.state_id;
+        const double cost =
+            g + m_distance->get_distance(*state, successor.state);
+        if (!(cost < m_table.g(next_id))) {
+            continue;
+        }
+        m_table.set_g(next_id, cost);
+        m_table.set_parent(next_id, state_id, successor.action_id);
+        if (heuristic(next_id) <= m_parameters.goal_tolerance) {
+            // Goals are not expanded; remember the cheapest one
+            if (m_goal_id < 0 || cost < m_table.g(m_goal_id)) {
+                m_goal_id = next_id;
+            }
+            continue;
+        }
+        if (m_table.closed(next_id)) {
+            continue;
+        }
+        const Key anchor_key = key(next_id, 0);
+        m_open[0].push(next_id, anchor_key);
+        if (is_closed_inadmissible(next_id)) {
+            continue;
+        }
+        for (int i = 1; i < static_cast<int>(m_open.size()); ++i) {
+            const Key next_key = key(next_id, i);
+            if (next_key.first <=
+                    m_parameters.anchor_weight * anchor_key.first) {
+                m_open[i].push(next_id, next_key);
+            }
+        }
+    }
+}
+
+}  // namespace planner
+}  // namespace libcozmo
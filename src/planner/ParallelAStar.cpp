@@ -0,0 +1,314 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "planner/ParallelAStar.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+
+namespace libcozmo {
+namespace planner {
+
+ParallelAStar::ParallelAStar(
+    const std::shared_ptr<statespace::SE2> statespace,
+    const std::shared_ptr<actionspace::ActionSpace> actionspace,
+    const std::shared_ptr<model::Model> model,
+    const std::shared_ptr<distance::Distance> distance,
+    const Parameters& parameters) :
+    m_successors(statespace, actionspace, model),
+    m_statespace(statespace),
+    m_distance(distance),
+    m_parameters(parameters),
+    m_num_threads(parameters.num_threads > 0 ?
+        parameters.num_threads :
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()))),
+    m_goal_id(-1),
+    m_goal_cost(std::numeric_limits<double>::infinity()),
+    m_num_in_flight(0),
+    m_num_idle(0),
+    m_done(false) {
+    if (m_distance == nullptr) {
+        throw std::invalid_argument("[ParallelAStar] Null distance given");
+    }
+    if (m_parameters.weight < 1.0) {
+        throw std::invalid_argument("[ParallelAStar] Weight is less than 1");
+    }
+    for (int i = 0; i < m_num_threads; ++i) {
+        m_workers.emplace_back(new Worker());
+    }
+}
+
+bool ParallelAStar::solve(
+    const statespace::SE2::State& start,
+    const statespace::SE2::State& goal,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    const auto start_time = std::chrono::steady_clock::now();
+    m_statistics = Statistics();
+    actions->clear();
+    if (states != nullptr) {
+        states->clear();
+    }
+    for (auto& worker : m_workers) {
+        worker->nodes.clear();
+        worker->open.clear();
+        worker->inbox.clear();
+        worker->num_expansions = 0;
+        worker->num_generated = 0;
+        worker->num_messages = 0;
+    }
+    m_goal_id = -1;
+    m_goal_cost = std::numeric_limits<double>::infinity();
+    m_num_in_flight = 0;
+    m_num_idle = 0;
+    m_done = false;
+
+    const int start_id = m_successors.get_or_create_state(start);
+    relax(
+        m_workers[owner(start)].get(),
+        Message{start_id, 0.0, -1, -1, start},
+        goal);
+
+    std::vector<std::thread> threads;
+    for (int i = 1; i < m_num_threads; ++i) {
+        threads.emplace_back(&ParallelAStar::search, this, i, goal);
+    }
+    search(0, goal);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& worker : m_workers) {
+        m_statistics.num_expansions += worker->num_expansions;
+        m_statistics.num_generated += worker->num_generated;
+        m_statistics.num_messages += worker->num_messages;
+        m_statistics.thread_expansions.push_back(worker->num_expansions);
+    }
+    if (m_goal_id >= 0) {
+        // Parents may have improved after the goal was recorded, so the
+        // cost is summed along the final path
+        const Node* previous = nullptr;
+        for (int id = m_goal_id; id >= 0; id = previous->parent) {
+            const Node* current = find_node(id);
+            if (previous != nullptr) {
+                m_statistics.path_cost += m_distance->get_distance(
+                    current->state, previous->state);
+            }
+            if (current->parent >= 0) {
+                actions->push_back(current->action);
+            }
+            if (states != nullptr) {
+                states->push_back(id);
+            }
+            previous = current;
+        }
+        std::reverse(actions->begin(), actions->end());
+        if (states != nullptr) {
+            std::reverse(states->begin(), states->end());
+        }
+    }
+    m_statistics.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_time).count();
+    if (m_statistics.seconds > 0) {
+        m_statistics.expansions_per_second =
+            m_statistics.num_expansions / m_statistics.seconds;
+    }
+    return m_goal_id >= 0;
+}
+
+int ParallelAStar::num_threads() const {
+    return m_num_threads;
+}
+
+const ParallelAStar::Statistics& ParallelAStar::get_statistics() const {
+    return m_statistics;
+}
+
+const ParallelAStar::Parameters& ParallelAStar::get_parameters() const {
+    return m_parameters;
+}
+
+int ParallelAStar::owner(const statespace::SE2::State& state) const {
+    return hash_value(state) % m_num_threads;
+}
+
+void ParallelAStar::search(
+    const int& thread_id, const statespace::SE2::State& goal) {
+    Worker* worker = m_workers[thread_id].get();
+    std::vector<Message> inbox;
+    std::vector<SE2Successors::Successor> successors;
+    while (true) {
+        {
+            std::lock_guard<std::mutex> lock(worker->inbox_mutex);
+            inbox.swap(worker->inbox);
+        }
+        for (const auto& message : inbox) {
+            relax(worker, message, goal);
+        }
+        // Only counted out once relaxed, so that no thread sees an empty
+        // inbox while a path is still pending
+        m_num_in_flight -= static_cast<int>(inbox.size());
+        inbox.clear();
+
+        // Every remaining path is pruned by the incumbent, which only
+        // decreases
+        if (!worker->open.empty() &&
+            worker->open.top_key().first >= m_goal_cost) {
+            worker->open.clear();
+        }
+        if (worker->open.empty()) {
+            if (wait_for_work(thread_id)) {
+                return;
+            }
+            continue;
+        }
+
+        const int state_id = worker->open.pop();
+        const Node& expanded = worker->nodes.at(state_id);
+        const statespace::SE2::State state = expanded.state;
+        const double g = expanded.g;
+        ++worker->num_expansions;
+        if (!m_successors.get_successors(state_id, &successors)) {
+            continue;
+        }
+        for (const auto& successor : successors) {
+            ++worker->num_generated;
+            const Message message{
+                successor.state_id,
+                g + m_distance->get_distance(state, successor.state),
+                state_id,
+                successor.action_id,
+                successor.state};
+            const int successor_owner = owner(successor.state);
+            if (successor_owner == thread_id) {
+                relax(worker, message, goal);
+            } else {
+                ++worker->num_messages;
+                send(successor_owner, message);
+            }
+        }
+    }
+}
+
+void ParallelAStar::relax(
+    Worker* worker,
+    const Message& message,
+    const statespace::SE2::State& goal) {
+    auto found = worker->nodes.find(message.state_id);
+    if (found == worker->nodes.end()) {
+        found = worker->nodes.emplace(message.state_id, Node{
+            std::numeric_limits<double>::infinity(),
+            m_distance->get_distance(message.state, goal),
+            -1,
+            -1,
+            message.state}).first;
+    }
+    Node& node = found->second;
+    if (message.g >= node.g) {
+        return;
+    }
+    node.g = message.g;
+    node.parent = message.parent;
+    node.action = message.action;
+
+    if (node.h <= m_parameters.goal_tolerance) {
+        std::lock_guard<std::mutex> lock(m_goal_mutex);
+        if (node.g < m_goal_cost) {
+            m_goal_id = message.state_id;
+            m_goal_cost = node.g;
+        }
+        return;
+    }
+    const double f = node.g + m_parameters.weight * node.h;
+    if (f < m_goal_cost) {
+        worker->open.push(message.state_id, Key(f, node.h));
+    } else {
+        worker->open.erase(message.state_id);
+    }
+}
+
+void ParallelAStar::send(const int& thread_id, const Message& message) {
+    // Counted in before it is visible, so that the search cannot be seen
+    // as over while the path is pending
+    ++m_num_in_flight;
+    Worker* worker = m_workers[thread_id].get();
+    {
+        std::lock_guard<std::mutex> lock(worker->inbox_mutex);
+        worker->inbox.push_back(message);
+    }
+    if (m_num_idle > 0) {
+        m_termination_condition.notify_all();
+    }
+}
+
+bool ParallelAStar::wait_for_work(const int& thread_id) {
+    Worker* worker = m_workers[thread_id].get();
+    std::unique_lock<std::mutex> lock(m_termination_mutex);
+    ++m_num_idle;
+    while (true) {
+        if (m_done) {
+            return true;
+        }
+        // An idle thread sends nothing, so once every thread is idle and
+        // no path is pending, no work can appear anymore
+        if (m_num_idle == m_num_threads && m_num_in_flight == 0) {
+            m_done = true;
+            m_termination_condition.notify_all();
+            return true;
+        }
+        {
+            std::lock_guard<std::mutex> inbox_lock(worker->inbox_mutex);
+            if (!worker->inbox.empty()) {
+                --m_num_idle;
+                return false;
+            }
+        }
+        // Notifications are sent without the lock, so a timeout bounds
+        // the delay of a missed one
+        m_termination_condition.wait_for(
+            lock, std::chrono::milliseconds(1));
+    }
+}
+
+const ParallelAStar::Node* ParallelAStar::find_node(
+    const int& state_id) const {
+    for (const auto& worker : m_workers) {
+        const auto found = worker->nodes.find(state_id);
+        if (found != worker->nodes.end()) {
+            return &found->second;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace planner
+}  // namespace libcozmo
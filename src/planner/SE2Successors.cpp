@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "planner/SE2Successors.hpp"
+#include <stdexcept>
+
+namespace libcozmo {
+namespace planner {
+
+SE2Successors::SE2Successors(
+    const std::shared_ptr<statespace::SE2> statespace,
+    const std::shared_ptr<actionspace::ActionSpace> actionspace,
+    const std::shared_ptr<model::Model> model) :
+    m_statespace(statespace),
+    m_model(model) {
+    if (m_statespace == nullptr) {
+        throw std::invalid_argument("[SE2Successors] Null statespace given");
+    }
+    if (actionspace == nullptr || actionspace->size() == 0) {
+        throw std::invalid_argument("[SE2Successors] Empty action space");
+    }
+    if (m_model == nullptr) {
+        throw std::invalid_argument("[SE2Successors] Null model given");
+    }
+    const Eigen::VectorXd first = actionspace->get_action(0)->vector();
+    m_actions.resize(actionspace->size(), first.size());
+    m_actions.row(0) = first.transpose();
+    for (int i = 1; i < actionspace->size(); ++i) {
+        m_actions.row(i) = actionspace->get_action(i)->vector().transpose();
+    }
+}
+
+bool SE2Successors::get_successors(
+    const int& state_id, std::vector<Successor>* successors) const {
+    successors->clear();
+    statespace::SE2::State state;
+    std::vector<statespace::SE2::State> predicted;
+    if (!get_state(state_id, &state) ||
+        !predict_successors(state, &predicted)) {
+        return false;
+    }
+
+    successors->reserve(predicted.size());
+    for (int i = 0; i < static_cast<int>(predicted.size()); ++i) {
+        if (predicted[i] == state) {
+            continue;
+        }
+        successors->push_back(Successor{i, -1, predicted[i]});
+    }
+    std::lock_guard<std::mutex> lock(m_statespace_mutex);
+    for (auto& successor : *successors) {
+        successor.state_id = m_statespace->get_or_create_state(successor.state);
+    }
+    return true;
+}
+
+bool SE2Successors::predict_successors(
+    const statespace::SE2::State& state,
+    std::vector<statespace::SE2::State>* successors) const {
+    Eigen::Vector3d continuous_state;
+    m_statespace->discrete_state_to_vector(state, &continuous_state);
+    const Eigen::MatrixXd input_states =
+        continuous_state.transpose().replicate(m_actions.rows(), 1);
+    Eigen::MatrixXd output_states;
+    if (!predict_states(m_actions, input_states, &output_states)) {
+        return false;
+    }
+    successors->resize(output_states.rows());
+    for (int i = 0; i < output_states.rows(); ++i) {
+        m_statespace->vector_to_discrete_state(
+            output_states.row(i).head<3>().transpose(), &(*successors)[i]);
+    }
+    return true;
+}
+
+bool SE2Successors::get_successor(
+    const int& state_id,
+    const int& action_id,
+    int* successor_id) const {
+    statespace::SE2::State state;
+    if (!get_state(state_id, &state) ||
+        action_id < 0 || action_id >= m_actions.rows()) {
+        return false;
+    }
+    Eigen::Vector3d continuous_state;
+    m_statespace->discrete_state_to_vector(state, &continuous_state);
+    Eigen::MatrixXd output_states;
+    if (!predict_states(
+            m_actions.row(action_id),
+            continuous_state.transpose(),
+            &output_states)) {
+        return false;
+    }
+    statespace::SE2::State successor;
+    m_statespace->vector_to_discrete_state(
+        output_states.row(0).head<3>().transpose(), &successor);
+    *successor_id = get_or_create_state(successor);
+    return true;
+}
+
+bool SE2Successors::get_state(
+    const int& state_id, statespace::SE2::State* state) const {
+    std::lock_guard<std::mutex> lock(m_statespace_mutex);
+    const auto found =
+        state_id >= 0 ? m_statespace->get_state(state_id) : nullptr;
+    if (found == nullptr) {
+        return false;
+    }
+    *state = *static_cast<const statespace::SE2::State*>(found);
+    return true;
+}
+
+int SE2Successors::get_or_create_state(
+    const statespace::SE2::State& state) const {
+    std::lock_guard<std::mutex> lock(m_statespace_mutex);
+    return m_statespace->get_or_create_state(state);
+}
+
+int SE2Successors::num_actions() const {
+    return m_actions.rows();
+}
+
+const Eigen::MatrixXd& SE2Successors::action_vectors() const {
+    return m_actions;
+}
+
+std::shared_ptr<statespace::SE2> SE2Successors::statespace() const {
+    return m_statespace;
+}
+
+std::shared_ptr<model::Model> SE2Successors::model() const {
+    return m_model;
+}
+
+bool SE2Successors::predict_states(
+    const Eigen::MatrixXd& actions,
+    const Eigen::MatrixXd& states,
+    Eigen::MatrixXd* output_states) const {
+    if (m_model->is_thread_safe()) {
+        return m_model->predict_states(actions, states, output_states);
+    }
+    std::lock_guard<std::mutex> lock(m_model_mutex);
+    return m_model->predict_states(actions, states, output_states);
+}
+
+}  // namespace planner
+}  // namespace libcozmo
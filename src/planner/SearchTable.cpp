@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "planner/SearchTable.hpp"
+#include <algorithm>
+
+namespace libcozmo {
+namespace planner {
+
+SearchTable::SearchTable() : m_query(1), m_closed_query(1) {}
+
+void SearchTable::reset() {
+    if (++m_query == 0) {
+        // Stamps wrapped; clear them once so that no entry is current
+        std::fill(m_stamps.begin(), m_stamps.end(), 0);
+        m_query = 1;
+    }
+}
+
+void SearchTable::reset_closed() {
+    if (++m_closed_query == 0) {
+        std::fill(m_closed.begin(), m_closed.end(), 0);
+        m_closed_query = 1;
+    }
+}
+
+void SearchTable::reserve(const int& num_states) {
+    if (num_states > size()) {
+        grow(num_states);
+    }
+}
+
+void SearchTable::extract_path(
+    const int& goal_id,
+    std::vector<int>* actions,
+    std::vector<int>* states) const {
+    actions->clear();
+    if (states != nullptr) {
+        states->clear();
+    }
+    for (int id = goal_id; id >= 0; id = parent(id)) {
+        if (parent(id) >= 0) {
+            actions->push_back(action(id));
+        }
+        if (states != nullptr) {
+            states->push_back(id);
+        }
+    }
+    std::reverse(actions->begin(), actions->end());
+    if (states != nullptr) {
+        std::reverse(states->begin(), states->end());
+    }
+}
+
+void SearchTable::grow(const int& num_states) {
+    const int new_size = std::max(num_states, 2 * size());
+    // New entries are stale; only their stamp is read before a write
+    m_stamps.resize(new_size, 0);
+    m_g.resize(new_size);
+    m_h.resize(new_size);
+    m_parent.resize(new_size);
+    m_action.resize(new_size);
+    m_closed.resize(new_size, 0);
+}
+
+}  // namespace planner
+}  // namespace libcozmo
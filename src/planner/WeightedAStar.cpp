@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "planner/WeightedAStar.hpp"
+#include <chrono>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace planner {
+
+WeightedAStar::WeightedAStar(
+    const std::shared_ptr<statespace::SE2> statespace,
+    const std::shared_ptr<actionspace::ActionSpace> actionspace,
+    const std::shared_ptr<model::Model> model,
+    const std::shared_ptr<distance::Distance> distance,
+    const Parameters& parameters) :
+    m_successors(statespace, actionspace, model),
+    m_statespace(statespace),
+    m_distance(distance),
+    m_parameters(parameters) {
+    if (m_distance == nullptr) {
+        throw std::invalid_argument("[WeightedAStar] Null distance given");
+    }
+    if (m_parameters.weight < 1.0) {
+        throw std::invalid_argument("[WeightedAStar] Weight is less than 1");
+    }
+}
+
+bool WeightedAStar::solve(
+    const statespace::SE2::State& start,
+    const statespace::SE2::State& goal,
+    std::vector<int>* actions,
+    std::vector<int>* states) {
+    const auto start_time = std::chrono::steady_clock::now();
+    m_statistics = Statistics();
+    m_table.reset();
+    m_table.reserve(m_statespace->size());
+    m_open.clear();
+    actions->clear();
+    if (states != nullptr) {
+        states->clear();
+    }
+
+    const int start_id = m_statespace->get_or_create_state(start);
+    m_table.set_g(start_id, 0);
+    m_open.push(start_id, Key(
+        m_parameters.weight * heuristic(start_id, goal),
+        heuristic(start_id, goal)));
+
+    int goal_id = -1;
+    std::vector<SE2Successors::Successor> successors;
+    while (!m_open.empty()) {
+        const int state_id = m_open.pop();
+        if (heuristic(state_id, goal) <= m_parameters.goal_tolerance) {
+            goal_id = state_id;
+            break;
+        }
+        if (m_parameters.max_expansions > 0 &&
+            m_statistics.num_expansions >= m_parameters.max_expansions) {
+            break;
+        }
+        m_table.set_closed(state_id);
+        ++m_statistics.num_expansions;
+
+        ++m_statistics.num_model_calls;
+        if (!m_successors.get_successors(state_id, &successors)) {
+            continue;
+        }
+        const auto state = m_statespace->get_state(state_id);
+        const double g = m_table.g(state_id);
+        for (const auto& successor : successors) {
+            ++m_statistics.num_generated;
+            if (m_table.closed(successor.state_id)) {
+                continue;
+            }
+            const double cost =
+                g + m_distance->get_distance(*state, successor.state);
+            if (cost < m_table.g(successor.state_id)) {
+                m_table.set_g(successor.state_id, cost);
+                m_table.set_parent(
+                    successor.state_id, state_id, successor.action_id);
+                const double h = heuristic(successor.state_id, goal);
+                m_open.push(
+                    successor.state_id,
+                    Key(cost + m_parameters.weight * h, h));
+            }
+        }
+    }
+
+    if (goal_id >= 0) {
+        m_statistics.path_cost = m_table.g(goal_id);
+        m_table.extract_path(goal_id, actions, states);
+    }
+    m_statistics.seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start_time).count();
+    return goal_id >= 0;
+}
+
+const WeightedAStar::Statistics& WeightedAStar::get_statistics() const {
+    return m_statistics;
+}
+
+const WeightedAStar::Parameters& WeightedAStar::get_parameters() const {
+    return m_parameters;
+}
+
+double WeightedAStar::heuristic(
+    const int& state_id, const statespace::SE2::State& goal) {
+    double h = m_table.h(state_id);
+    if (h < 0) {
+        h = m_distance->get_distance(*m_statespace->get_state(state_id), goal);
+        m_table.set_h(state_id, h);
+    }
+    return h;
+}
+
+}  // namespace planner
+}  // namespace libcozmo
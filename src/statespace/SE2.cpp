@@ -193,6 +193,29 @@ void SE2::copy_state(
 
 double SE2::get_resolution() const { return m_resolution; }
 
+int SE2::get_num_theta_vals() const { return m_num_theta_vals; }
+
+void SE2::discrete_state_to_vector(
+    const StateSpace::State& _state,
+    Eigen::Vector3d* _continuous_state) const {
+    const State& state = static_cast<const State&>(_state);
+    _continuous_state->head<2>() =
+        discrete_position_to_continuous(Eigen::Vector2i(state.x, state.y));
+    (*_continuous_state)[2] = discrete_angle_to_continuous(state.theta);
+}
+
+void SE2::vector_to_discrete_state(
+    const Eigen::Vector3d& _continuous_state,
+    StateSpace::State* _state) const {
+    const Eigen::Vector2i position =
+        continuous_position_to_discrete(_continuous_state.head<2>());
+    State* state = static_cast<State*>(_state);
+    *state = State(
+        position.x(),
+        position.y(),
+        continuous_angle_to_discrete(_continuous_state[2]));
+}
+
 StateSpace::State* SE2::create_state() {
     m_state_map.push_back(new State());
     const auto state = m_state_map.back();
@@ -213,6 +236,9 @@ double SE2::normalize_angle_rad(const double& theta_rad) const {
 }
 
 double SE2::discrete_angle_to_continuous(const int& theta) const {
+    if (theta >= 0 && theta < m_num_theta_vals) {
+        return m_headings->angle(theta);
+    }
     return normalize_angle_rad(theta * (2 * M_PI /m_num_theta_vals));
 }
 
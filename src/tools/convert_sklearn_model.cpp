@@ -0,0 +1,209 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <Python.h>
+#include <Eigen/Dense>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "model/ModelFile.hpp"
+
+/// Converts a pickled scikit-learn GaussianProcessRegressor into the native
+/// model file format (see libcozmo::model::ModelFile) so it can be loaded by
+/// NativeGPRModel without the python interpreter.
+///
+/// Supported kernels are RBF and Matern (nu = 1.5 or 2.5), optionally
+/// multiplied by a ConstantKernel and summed with a WhiteKernel.
+
+using libcozmo::model::GPParameters;
+using libcozmo::model::KernelType;
+using libcozmo::model::ModelFile;
+
+/// Converts a python list of lists into a matrix; a flat list is converted
+/// into a column vector
+///
+/// \param p_list Python list
+/// \param[out] matrix Output matrix
+/// \return True if converted successfully; false otherwise
+static bool list_to_matrix(PyObject* p_list, Eigen::MatrixXd* matrix) {
+    if (p_list == NULL || !PyList_Check(p_list)) {
+        return false;
+    }
+    const int rows = PyList_Size(p_list);
+    if (rows == 0) {
+        matrix->resize(0, 0);
+        return true;
+    }
+    PyObject* p_first = PyList_GetItem(p_list, 0);
+    const int cols = PyList_Check(p_first) ? PyList_Size(p_first) : 1;
+    matrix->resize(rows, cols);
+    for (int i = 0; i < rows; ++i) {
+        PyObject* p_row = PyList_GetItem(p_list, i);
+        for (int j = 0; j < cols; ++j) {
+            PyObject* p_value =
+                PyList_Check(p_row) ? PyList_GetItem(p_row, j) : p_row;
+            (*matrix)(i, j) = PyFloat_AsDouble(p_value);
+        }
+    }
+    return !PyErr_Occurred();
+}
+
+/// Loads the pickled model and extracts its parameters
+///
+/// \param model_path The path to the pickled model
+/// \param[out] parameters Parameters of the model
+/// \return True if extracted successfully; false otherwise
+static bool export_model(
+    const std::string& model_path,
+    GPParameters* parameters) {
+    std::stringstream buf;
+    buf << "import _pickle as pickle" << std::endl
+        << "import numpy as np" << std::endl
+        << "def export_model(filename):" << std::endl
+        << "    model = pickle.load(open(filename, 'rb'))" << std::endl
+        << "    params = {'signal': 1.0, 'base': None," << std::endl
+        << "              'noise': float(np.mean(model.alpha))}" << std::endl
+        << "    def visit(k):" << std::endl
+        << "        name = type(k).__name__" << std::endl
+        << "        if name in ('Sum', 'Product'):" << std::endl
+        << "            visit(k.k1)" << std::endl
+        << "            visit(k.k2)" << std::endl
+        << "        elif name == 'ConstantKernel':" << std::endl
+        << "            params['signal'] *= k.constant_value" << std::endl
+        << "        elif name == 'WhiteKernel':" << std::endl
+        << "            params['noise'] += k.noise_level" << std::endl
+        << "        elif name == 'RBF':" << std::endl
+        << "            params['base'] = ('rbf', k.length_scale)" << std::endl
+        << "        elif name == 'Matern' and k.nu in (1.5, 2.5):" << std::endl
+        << "            params['base'] = ('matern_%d_2' % (2 * k.nu)," << std::endl
+        << "                              k.length_scale)" << std::endl
+        << "        else:" << std::endl
+        << "            raise ValueError('Unsupported kernel ' + name)" << std::endl
+        << "    visit(model.kernel_)" << std::endl
+        << "    if params['base'] is None:" << std::endl
+        << "        raise ValueError('Missing RBF or Matern kernel')" << std::endl
+        << "    X = np.asarray(model.X_train_, dtype=float)" << std::endl
+        << "    alpha = np.asarray(model.alpha_, dtype=float)" << std::endl
+        << "    alpha = alpha.reshape(X.shape[0], -1)" << std::endl
+        << "    k = alpha.shape[1]" << std::endl
+        << "    mean = np.broadcast_to(np.atleast_1d(" << std::endl
+        << "        getattr(model, '_y_train_mean', 0.0)), (k,))" << std::endl
+        << "    scale = np.broadcast_to(np.atleast_1d(" << std::endl
+        << "        getattr(model, '_y_train_std', 1.0)), (k,))" << std::endl
+        << "    return (params['base'][0]," << std::endl
+        << "            np.atleast_1d(params['base'][1]).tolist()," << std::endl
+        << "            float(params['signal']), float(params['noise'])," << std::endl
+        << "            X.tolist(), alpha.tolist(), model.L_.tolist()," << std::endl
+        << "            mean.tolist(), scale.tolist())" << std::endl;
+
+    PyObject* p_compiled_fn =
+        Py_CompileString(buf.str().c_str(), "", Py_file_input);
+    if (p_compiled_fn == NULL) {
+        return false;
+    }
+    PyObject* p_module =
+        PyImport_ExecCodeModule("convert_sklearn_module", p_compiled_fn);
+    Py_DecRef(p_compiled_fn);
+    if (p_module == NULL) {
+        return false;
+    }
+    PyObject* p_export_fn = PyObject_GetAttrString(p_module, "export_model");
+    PyObject* p_file = Py_BuildValue("s", model_path.c_str());
+    PyObject* p_args = PyTuple_Pack(1, p_file);
+    PyObject* p_result = PyObject_CallObject(p_export_fn, p_args);
+    Py_DecRef(p_args);
+    Py_DecRef(p_file);
+    Py_DecRef(p_export_fn);
+    Py_DecRef(p_module);
+    if (p_result == NULL) {
+        return false;
+    }
+
+    const std::string kernel_name =
+        PyUnicode_AsUTF8(PyTuple_GetItem(p_result, 0));
+    if (kernel_name == "rbf") {
+        parameters->kernel_type = KernelType::RBF;
+    } else if (kernel_name == "matern_3_2") {
+        parameters->kernel_type = KernelType::MATERN_3_2;
+    } else {
+        parameters->kernel_type = KernelType::MATERN_5_2;
+    }
+    parameters->signal_variance =
+        PyFloat_AsDouble(PyTuple_GetItem(p_result, 2));
+    parameters->noise_variance =
+        PyFloat_AsDouble(PyTuple_GetItem(p_result, 3));
+
+    Eigen::MatrixXd length_scales, target_mean, target_scale;
+    const bool success =
+        list_to_matrix(PyTuple_GetItem(p_result, 1), &length_scales) &&
+        list_to_matrix(PyTuple_GetItem(p_result, 4), &parameters->inputs) &&
+        list_to_matrix(PyTuple_GetItem(p_result, 5), &parameters->weights) &&
+        list_to_matrix(PyTuple_GetItem(p_result, 6), &parameters->cholesky) &&
+        list_to_matrix(PyTuple_GetItem(p_result, 7), &target_mean) &&
+        list_to_matrix(PyTuple_GetItem(p_result, 8), &target_scale);
+    Py_DecRef(p_result);
+    // Per dimension values come back as single column matrices; any other
+    // shape, e.g. an empty list, is malformed
+    if (!success || length_scales.cols() != 1 || target_mean.cols() != 1 ||
+        target_scale.cols() != 1) {
+        return false;
+    }
+    parameters->length_scales = length_scales.col(0);
+    parameters->target_mean = target_mean.col(0);
+    parameters->target_scale = target_scale.col(0);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0]
+                  << " <sklearn_model.pkl> <output_model_file>" << std::endl;
+        return 1;
+    }
+
+    Py_Initialize();
+    GPParameters parameters;
+    const bool exported = export_model(argv[1], &parameters);
+    if (!exported) {
+        PyErr_Print();
+    }
+    Py_Finalize();
+    if (!exported) {
+        std::cerr << "Unable to load model " << argv[1] << std::endl;
+        return 1;
+    }
+
+    if (!ModelFile::write(argv[2], parameters)) {
+        std::cerr << "Unable to write model file " << argv[2] << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << parameters.inputs.rows() << " samples to "
+              << argv[2] << std::endl;
+    return 0;
+}
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <Python.h>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "model/GPRModel.hpp"
+#include "model/ModelEvaluator.hpp"
+#include "model/NativeGPRModel.hpp"
+#include "model/ScikitLearnFramework.hpp"
+
+/// Evaluates one or more models on a logged dataset (see
+/// libcozmo::model::Dataset) and prints the distributions of the position
+/// and heading errors and the throughput of each model.
+///
+/// Models ending in ".pkl" are loaded as pickled scikit-learn models
+/// (GPRModel); all other models are loaded as native model files
+/// (NativeGPRModel).
+
+using libcozmo::model::GPRModel;
+using libcozmo::model::Model;
+using libcozmo::model::ModelEvaluator;
+using libcozmo::model::NativeGPRModel;
+using libcozmo::model::ScikitLearnFramework;
+
+/// Loads the model at the given path
+///
+/// \param model_path The path to the model
+/// \return The model; null if it can't be loaded
+static std::shared_ptr<Model> load_model(const std::string& model_path) {
+    const std::string extension = ".pkl";
+    try {
+        if (model_path.size() >= extension.size() &&
+            model_path.compare(
+                model_path.size() - extension.size(),
+                extension.size(),
+                extension) == 0) {
+            return std::make_shared<GPRModel>(
+                std::make_shared<ScikitLearnFramework>(model_path));
+        }
+        return std::make_shared<NativeGPRModel>(model_path);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return nullptr;
+    }
+}
+
+/// Prints one row of the error table
+///
+/// \param label Name of the error
+/// \param statistics The error distribution
+static void print_statistics(
+    const std::string& label,
+    const ModelEvaluator::ErrorStatistics& statistics) {
+    std::cout << "  " << std::setw(9) << std::left << label << std::right
+              << std::setw(12) << statistics.mean
+              << std::setw(12) << statistics.rmse
+              << std::setw(12) << statistics.median
+              << std::setw(12) << statistics.percentile_90
+              << std::setw(12) << statistics.percentile_99
+              << std::setw(12) << statistics.max << std::endl;
+}
+
+/// Prints the evaluation results of one model
+///
+/// \param report The evaluation results
+static void print_report(const ModelEvaluator::Report& report) {
+    std::cout << std::endl << report.name << std::endl
+              << std::fixed << std::setprecision(0)
+              << "  " << report.num_samples - report.num_failures
+              << " predicted, " << report.num_failures << " failed, "
+              << report.samples_per_second << " samples/s"
+              << std::setprecision(4) << " (" << report.seconds << " s)"
+              << std::endl
+              << "  " << std::setw(9) << std::left << "error" << std::right
+              << std::setw(12) << "mean"
+              << std::setw(12) << "rmse"
+              << std::setw(12) << "median"
+              << std::setw(12) << "p90"
+              << std::setw(12) << "p99"
+              << std::setw(12) << "max" << std::endl;
+    print_statistics("position", report.position_error);
+    print_statistics("heading", report.heading_error);
+}
+
+int main(int argc, char* argv[]) {
+    int chunk_size = 65536;
+    int num_threads = 0;
+    std::vector<std::string> arguments;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        if (argument == "--chunk-size" && i + 1 < argc) {
+            chunk_size = std::atoi(argv[++i]);
+        } else if (argument == "--threads" && i + 1 < argc) {
+            num_threads = std::atoi(argv[++i]);
+        } else {
+            arguments.push_back(argument);
+        }
+    }
+    if (arguments.size() < 2 || chunk_size <= 0) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--chunk-size N] [--threads N]"
+                  << " <dataset.csv> <model> [<model> ...]" << std::endl;
+        return 1;
+    }
+
+    Py_Initialize();
+    int status = 0;
+    {
+        std::vector<std::shared_ptr<Model>> models;
+        const std::vector<std::string> names(
+            arguments.begin() + 1, arguments.end());
+        for (const auto& name : names) {
+            models.push_back(load_model(name));
+            if (!models.back()) {
+                std::cerr << "Unable to load model " << name << std::endl;
+                status = 1;
+            }
+        }
+
+        if (status == 0) {
+            try {
+                ModelEvaluator evaluator(models, names, num_threads);
+                const int num_samples =
+                    evaluator.evaluate_file(arguments[0], chunk_size);
+                std::cout << "Evaluated " << num_samples << " samples from "
+                          << arguments[0] << std::endl;
+
+                for (const auto& report : evaluator.get_reports()) {
+                    print_report(report);
+                }
+            } catch (const std::exception& e) {
+                std::cerr << e.what() << std::endl;
+                status = 1;
+            }
+        }
+    }
+    Py_Finalize();
+    return status;
+}
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "model/Dataset.hpp"
+#include "model/GPTrainer.hpp"
+#include "model/ModelFile.hpp"
+
+/// Trains an exact GP on a logged dataset (see libcozmo::model::Dataset)
+/// and writes it in the native model file format (see
+/// libcozmo::model::ModelFile) so it can be loaded by NativeGPRModel.
+
+using libcozmo::model::Dataset;
+using libcozmo::model::GPParameters;
+using libcozmo::model::GPTrainer;
+using libcozmo::model::KernelType;
+using libcozmo::model::ModelFile;
+
+int main(int argc, char* argv[]) {
+    GPTrainer::Parameters parameters;
+    int num_threads = 0;
+    bool valid = true;
+    std::vector<std::string> arguments;
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const bool has_value = i + 1 < argc;
+        if (argument == "--kernel" && has_value) {
+            const std::string kernel = argv[++i];
+            if (kernel == "rbf") {
+                parameters.kernel_type = KernelType::RBF;
+            } else if (kernel == "matern32") {
+                parameters.kernel_type = KernelType::MATERN_3_2;
+            } else if (kernel == "matern52") {
+                parameters.kernel_type = KernelType::MATERN_5_2;
+            } else {
+                valid = false;
+            }
+        } else if (argument == "--isotropic") {
+            parameters.isotropic = true;
+        } else if (argument == "--restarts" && has_value) {
+            parameters.num_restarts = std::atoi(argv[++i]);
+        } else if (argument == "--max-samples" && has_value) {
+            parameters.max_samples = std::atoi(argv[++i]);
+        } else if (argument == "--seed" && has_value) {
+            parameters.seed = std::atoi(argv[++i]);
+        } else if (argument == "--threads" && has_value) {
+            num_threads = std::atoi(argv[++i]);
+        } else {
+            arguments.push_back(argument);
+        }
+    }
+    if (!valid || arguments.size() != 2) {
+        std::cerr << "Usage: " << argv[0]
+                  << " [--kernel rbf|matern32|matern52] [--isotropic]"
+                  << " [--restarts N] [--max-samples N] [--seed N]"
+                  << " [--threads N] <dataset.csv> <output_model_file>"
+                  << std::endl;
+        return 1;
+    }
+
+    GPParameters model;
+    GPTrainer::Result result;
+    try {
+        const Dataset dataset(arguments[0]);
+        const GPTrainer trainer(parameters, num_threads);
+        if (!trainer.train(dataset, &model, &result)) {
+            std::cerr << "Unable to train model on " << arguments[0]
+                      << std::endl;
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "Trained on " << result.num_samples << " samples"
+              << std::endl
+              << "  log marginal likelihood " << result.log_marginal_likelihood
+              << " (restart " << result.best_restart << " of "
+              << result.restart_log_marginal_likelihoods.size() << ")"
+              << std::endl
+              << "  length scales " << model.length_scales.transpose()
+              << std::endl
+              << "  signal variance " << model.signal_variance
+              << ", noise variance " << model.noise_variance << std::endl;
+
+    if (!ModelFile::write(arguments[1], model)) {
+        std::cerr << "Unable to write model file " << arguments[1]
+                  << std::endl;
+        return 1;
+    }
+    std::cout << "Wrote " << arguments[1] << std::endl;
+    return 0;
+}
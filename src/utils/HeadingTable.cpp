@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "utils/HeadingTable.hpp"
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+
+namespace libcozmo {
+namespace utils {
+
+std::shared_ptr<const HeadingTable> HeadingTable::get(const int& num_bins) {
+    static std::mutex mutex;
+    static std::map<int, std::shared_ptr<const HeadingTable>> tables;
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& table = tables[num_bins];
+    if (!table) {
+        table = std::make_shared<const HeadingTable>(num_bins);
+    }
+    return table;
+}
+
+HeadingTable::HeadingTable(const int& num_bins) :
+    m_num_bins(num_bins),
+    m_bin_size(num_bins > 0 ? 2.0 * M_PI / num_bins : 0) {
+    if (m_num_bins <= 0) {
+        throw std::invalid_argument(
+            "[HeadingTable] number of bins must be positive");
+    }
+    m_angles.resize(m_num_bins);
+    m_signed_angles.resize(m_num_bins);
+    m_cos.resize(m_num_bins);
+    m_sin.resize(m_num_bins);
+    for (int i = 0; i < m_num_bins; ++i) {
+        m_angles[i] = i * m_bin_size;
+        m_signed_angles[i] =
+            2 * i <= m_num_bins ? m_angles[i] : m_angles[i] - 2.0 * M_PI;
+        m_cos[i] = std::cos(m_angles[i]);
+        m_sin[i] = std::sin(m_angles[i]);
+    }
+}
+
+}  // namespace utils
+}  // namespace libcozmo
@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "utils/ThreadPool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace libcozmo {
+namespace utils {
+
+ThreadPool::ThreadPool(const int& num_threads) : m_stop(false) {
+    const int size = num_threads > 0 ? num_threads :
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    for (int i = 0; i < size; ++i) {
+        m_threads.emplace_back(&ThreadPool::run, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_condition.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+std::future<void> ThreadPool::submit(const std::function<void()>& task) {
+    std::packaged_task<void()> packaged_task(task);
+    std::future<void> future = packaged_task.get_future();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push(std::move(packaged_task));
+    }
+    m_condition.notify_one();
+    return future;
+}
+
+void ThreadPool::parallel_for(
+    const int& num_tasks,
+    const std::function<void(int)>& task) {
+    if (num_tasks <= 0) {
+        return;
+    }
+
+    // Workers and the calling thread pull indices from a shared counter.
+    // Only started indices are waited for, so helpers that are still queued
+    // when the work runs out (e.g. in nested calls) do not block the caller.
+    // A throwing task still counts as done; the first exception is kept and
+    // rethrown on the calling thread
+    struct State {
+        std::function<void(int)> task;
+        std::atomic<int> next;
+        int done;
+        std::exception_ptr exception;
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+    const auto state = std::make_shared<State>();
+    state->task = task;
+    state->next = 0;
+    state->done = 0;
+
+    auto worker = [state, num_tasks]() {
+        for (int i = state->next++; i < num_tasks; i = state->next++) {
+            std::exception_ptr exception;
+            try {
+                state->task(i);
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (exception && !state->exception) {
+                state->exception = exception;
+            }
+            if (++state->done == num_tasks) {
+                state->condition.notify_all();
+            }
+        }
+    };
+
+    const int num_helpers = std::min(size(), num_tasks - 1);
+    for (int i = 0; i < num_helpers; ++i) {
+        submit(worker);
+    }
+    worker();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(
+        lock, [&state, num_tasks]() { return state->done == num_tasks; });
+    if (state->exception) {
+        std::rethrow_exception(state->exception);
+    }
+}
+
+int ThreadPool::size() const {
+    return m_threads.size();
+}
+
+void ThreadPool::run() {
+    while (true) {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_condition.wait(
+                lock, [this]() { return m_stop || !m_tasks.empty(); });
+            if (m_stop && m_tasks.empty()) {
+                return;
+            }
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+        task();
+    }
+}
+
+}  // namespace utils
+}  // namespace libcozmo
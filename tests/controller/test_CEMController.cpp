@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include "actionspace/GenericActionSpace.hpp"
+#include "controller/CEMController.hpp"
+#include "model/UnicycleModel.hpp"
+
+namespace libcozmo {
+namespace controller {
+namespace test {
+
+class CEMControllerTest : public ::testing::Test {
+ protected:
+    CEMControllerTest() :
+        actionspace(
+            std::vector<double>{0.5, 1.0}, std::vector<double>{1.0, 2.0}, 8),
+        model(std::make_shared<model::UnicycleModel>()) {
+        parameters.horizon = 2;
+        parameters.num_samples = 400;
+        parameters.num_elites = 20;
+        parameters.max_iterations = 10;
+        parameters.time_budget = 0.0;
+        parameters.seed = 1;
+    }
+
+    actionspace::GenericActionSpace actionspace;
+    std::shared_ptr<model::Model> model;
+    CEMController::Parameters parameters;
+};
+
+TEST_F(CEMControllerTest, SolveTest) {
+    // Driving straight ahead as far as possible reaches the goal first
+    CEMController controller(
+        model, actionspace,
+        CEMController::goal_cost(Eigen::Vector3d(4.0, 0.0, 0.0), 1.0, 1.0),
+        parameters, 2);
+
+    CEMController::Solution solution;
+    ASSERT_TRUE(controller.solve(Eigen::Vector3d(0.0, 0.0, 0.0), &solution));
+    ASSERT_EQ(2, solution.action_ids.size());
+    EXPECT_EQ(10, solution.num_iterations);
+    EXPECT_NEAR(2.0, solution.cost, 1e-9);
+    for (int t = 0; t < 2; ++t) {
+        const Eigen::VectorXd action =
+            actionspace.get_action(solution.action_ids[t])->vector();
+        EXPECT_NEAR(2.0, action[0] * action[1], 1e-9);
+        EXPECT_NEAR(0.0, action[2], 1e-9);
+    }
+
+    // The distributions concentrate on the best sequence
+    for (int t = 0; t < 2; ++t) {
+        EXPECT_NEAR(1.0, controller.distribution().row(t).sum(), 1e-9);
+        EXPECT_GT(controller.distribution()(t, solution.action_ids[t]), 0.5);
+    }
+}
+
+TEST_F(CEMControllerTest, WarmStartTest) {
+    CEMController controller(
+        model, actionspace,
+        CEMController::goal_cost(Eigen::Vector3d(4.0, 0.0, 0.0), 1.0, 1.0),
+        parameters, 2);
+
+    CEMController::Solution solution;
+    ASSERT_TRUE(controller.solve(Eigen::Vector3d(0.0, 0.0, 0.0), &solution));
+
+    // After executing the first action the shifted solution is kept, so
+    // the next solve is at least as good as continuing the previous plan
+    // (reaching the goal, then driving 2 past it)
+    controller.shift();
+    EXPECT_NEAR(
+        1.0 / actionspace.size(), controller.distribution()(1, 0), 1e-12);
+    ASSERT_TRUE(controller.solve(Eigen::Vector3d(2.0, 0.0, 0.0), &solution));
+    EXPECT_LE(solution.cost, 2.0 + 1e-9);
+    // Best is to reach the goal and leave it as little as possible
+    EXPECT_NEAR(0.5, solution.cost, 1e-9);
+}
+
+TEST_F(CEMControllerTest, TimeBudgetTest) {
+    parameters.max_iterations = 1000;
+    parameters.time_budget = 1e-9;
+    CEMController controller(
+        model, actionspace,
+        CEMController::goal_cost(Eigen::Vector3d(1.0, 1.0, 0.0), 1.0, 0.1),
+        parameters);
+
+    CEMController::Solution solution;
+    ASSERT_TRUE(controller.solve(Eigen::Vector3d(0.0, 0.0, 0.0), &solution));
+    EXPECT_EQ(1, solution.num_iterations);
+}
+
+TEST_F(CEMControllerTest, InvalidParametersTest) {
+    const auto cost =
+        CEMController::goal_cost(Eigen::Vector3d(1.0, 1.0, 0.0), 1.0, 0.1);
+    CEMController::Parameters invalid = parameters;
+    invalid.num_elites = invalid.num_samples + 1;
+    EXPECT_THROW(
+        CEMController(model, actionspace, cost, invalid),
+        std::invalid_argument);
+
+    invalid = parameters;
+    invalid.smoothing = 0.0;
+    EXPECT_THROW(
+        CEMController(model, actionspace, cost, invalid),
+        std::invalid_argument);
+
+    EXPECT_THROW(
+        CEMController(
+            model, actionspace, CEMController::CostFunction(), parameters),
+        std::invalid_argument);
+
+    // Wrong state size
+    CEMController controller(model, actionspace, cost, parameters);
+    CEMController::Solution solution;
+    EXPECT_FALSE(controller.solve(Eigen::Vector2d(0.0, 0.0), &solution));
+}
+
+}  // namespace test
+}  // namespace controller
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
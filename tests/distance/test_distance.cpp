@@ -28,15 +28,39 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include <gtest/gtest.h>
+#include <cstdlib>
 #include "statespace/SE2.hpp"
 #include "distance/SE2.hpp"
 #include "distance/translation.hpp"
 #include "distance/orientation.hpp"
+#include "distance/weighted_se2.hpp"
+#include "distance/distance_table.hpp"
+#include "distance/dubins.hpp"
+#include "distance/reeds_shepp.hpp"
+#include "distance/heading.hpp"
+#include "distance/grid_heuristic.hpp"
 
 namespace libcozmo {
 namespace distance {
 namespace test {
 
+/// Distance that only implements get_distance(), i.e. the number of cells
+/// between two states along x and y
+class CellDistance : public Distance {
+ public:
+    double get_distance(
+        const libcozmo::statespace::StateSpace::State& _state_1,
+        const libcozmo::statespace::StateSpace::State& _state_2)
+        const override {
+        const auto& state_1 =
+            static_cast<const statespace::SE2::State&>(_state_1);
+        const auto& state_2 =
+            static_cast<const statespace::SE2::State&>(_state_2);
+        return std::abs(state_1.X() - state_2.X()) +
+            std::abs(state_1.Y() - state_2.Y());
+    }
+};
+
 TEST(DistanceTest, TestSE2) {
     // Checking SE2 distance calculated correctly
     const auto statespace = std::make_shared<statespace::SE2>(0.1, 8);
@@ -72,6 +96,381 @@ TEST(DistanceTest, TestOrientation) {
         0.01);
 }
 
+TEST(DistanceTest, TestBatchDistances) {
+    // Checking batch distances match the pairwise distances
+    const auto statespace = std::make_shared<statespace::SE2>(0.1, 8);
+    const distance::SE2 se2(statespace);
+    const distance::Translation trans(statespace);
+    const distance::Orientation orient(statespace);
+    const statespace::SE2::State query(2, -1, 6);
+    // Headings outside [0, 8) included
+    Eigen::MatrixXi states(24, 3);
+    for (int i = 0; i < states.rows(); ++i) {
+        states.row(i) << i % 5 - 2, 3 - i % 7, i - 8;
+    }
+
+    Eigen::VectorXd se2_distances;
+    Eigen::VectorXd trans_distances;
+    Eigen::VectorXd orient_distances;
+    se2.get_distances(query, states, &se2_distances);
+    trans.get_distances(query, states, &trans_distances);
+    orient.get_distances(query, states, &orient_distances);
+    ASSERT_EQ(states.rows(), se2_distances.size());
+    ASSERT_EQ(states.rows(), trans_distances.size());
+    ASSERT_EQ(states.rows(), orient_distances.size());
+    for (int i = 0; i < states.rows(); ++i) {
+        const statespace::SE2::State state(
+            states(i, 0), states(i, 1), states(i, 2));
+        EXPECT_NEAR(se2.get_distance(query, state), se2_distances(i), 1e-9);
+        EXPECT_NEAR(
+            trans.get_distance(query, state), trans_distances(i), 1e-9);
+        EXPECT_NEAR(
+            orient.get_distance(query, state), orient_distances(i), 1e-9);
+    }
+
+    // Checking a query heading outside [0, 8)
+    const statespace::SE2::State wrapped_query(2, -1, -3);
+    se2.get_distances(wrapped_query, states, &se2_distances);
+    orient.get_distances(wrapped_query, states, &orient_distances);
+    for (int i = 0; i < states.rows(); ++i) {
+        const statespace::SE2::State state(
+            states(i, 0), states(i, 1), states(i, 2));
+        EXPECT_NEAR(
+            se2.get_distance(wrapped_query, state), se2_distances(i), 1e-9);
+        EXPECT_NEAR(
+            orient.get_distance(wrapped_query, state),
+            orient_distances(i),
+            1e-9);
+    }
+
+    // Checking malformed inputs are rejected
+    EXPECT_THROW(
+        se2.get_distances(query, Eigen::MatrixXi(4, 2), &se2_distances),
+        std::invalid_argument);
+
+    // Checking the default batch loops over the pairwise distances
+    const CellDistance cells;
+    Eigen::VectorXd cell_distances;
+    cells.get_distances(query, states, &cell_distances);
+    ASSERT_EQ(states.rows(), cell_distances.size());
+    for (int i = 0; i < states.rows(); ++i) {
+        EXPECT_EQ(
+            cells.get_distance(
+                query,
+                statespace::SE2::State(
+                    states(i, 0), states(i, 1), states(i, 2))),
+            cell_distances(i));
+    }
+    EXPECT_THROW(
+        cells.get_distances(query, Eigen::MatrixXi(4, 2), &cell_distances),
+        std::invalid_argument);
+}
+
+TEST(DistanceTest, TestWeightedSE2) {
+    // Checking weighted metric equals the weighted component metrics
+    const auto statespace = std::make_shared<statespace::SE2>(0.1, 8);
+    const distance::Translation trans(statespace);
+    const distance::Orientation orient(statespace);
+    const double translation_weight = 2.5;
+    const double rotation_weight = 0.75;
+    const distance::WeightedSE2 weighted(
+        statespace, translation_weight, rotation_weight);
+    // Headings outside [0, 8) included
+    Eigen::MatrixXi states(40, 3);
+    for (int i = 0; i < states.rows(); ++i) {
+        states.row(i) << 7 - i % 9, i % 6 - 11, i % 24 - 8;
+    }
+
+    for (const int& theta : {5, -3, 13}) {
+        const statespace::SE2::State query(-3, 4, theta);
+        Eigen::VectorXd distances;
+        weighted.get_distances(query, states, &distances);
+        ASSERT_EQ(states.rows(), distances.size());
+        for (int i = 0; i < states.rows(); ++i) {
+            const statespace::SE2::State state(
+                states(i, 0), states(i, 1), states(i, 2));
+            const double expected =
+                translation_weight * trans.get_distance(query, state) +
+                rotation_weight * orient.get_distance(query, state);
+            EXPECT_EQ(expected, weighted.get_distance(query, state));
+            EXPECT_EQ(expected, distances(i));
+        }
+    }
+
+    // Checking invalid arguments
+    EXPECT_THROW(
+        distance::WeightedSE2(nullptr, 1.0, 1.0), std::invalid_argument);
+    EXPECT_THROW(
+        distance::WeightedSE2(statespace, -1.0, 1.0), std::invalid_argument);
+}
+
+TEST(DistanceTest, TestDistanceTable) {
+    // Checking table lookups match the SE2 metric inside and outside radius
+    const auto statespace = std::make_shared<statespace::SE2>(0.1, 8);
+    const auto table = std::make_shared<distance::DistanceTable>(statespace, 4);
+    const distance::SE2 se2(statespace);
+    const distance::SE2 se2_table(statespace, table);
+    const statespace::SE2::State query(1, -2, 7);
+    Eigen::MatrixXi states(60, 3);
+    for (int i = 0; i < states.rows(); ++i) {
+        states.row(i) << (i * 7) % 13 - 6, (i * 5) % 11 - 6, i % 8;
+    }
+
+    Eigen::VectorXd distances;
+    se2_table.get_distances(query, states, &distances);
+    ASSERT_EQ(states.rows(), distances.size());
+    for (int i = 0; i < states.rows(); ++i) {
+        const statespace::SE2::State state(
+            states(i, 0), states(i, 1), states(i, 2));
+        const double expected = se2.get_distance(query, state);
+        EXPECT_NEAR(expected, se2_table.get_distance(query, state), 1e-9);
+        EXPECT_NEAR(expected, distances(i), 1e-9);
+        EXPECT_NEAR(expected, table->get_distance(query, state), 1e-9);
+    }
+    EXPECT_TRUE(table->contains(-4, 4));
+    EXPECT_FALSE(table->contains(5, 0));
+    EXPECT_DOUBLE_EQ(
+        table->compute_distance(3, -2, -3), table->get_distance(-3, 2, 5));
+
+    // Checking invalid arguments
+    EXPECT_THROW(
+        distance::DistanceTable(nullptr, 4), std::invalid_argument);
+    EXPECT_THROW(
+        distance::DistanceTable(statespace, -1), std::invalid_argument);
+    EXPECT_THROW(
+        distance::SE2(
+            std::make_shared<statespace::SE2>(0.2, 8), table),
+        std::invalid_argument);
+}
+
+TEST(DistanceTest, TestDubins) {
+    // Checking known Dubins path lengths for a unit turning radius
+    const auto statespace = std::make_shared<statespace::SE2>(1.0, 8);
+    const distance::Dubins dubins(statespace, 1.0, 4);
+    const statespace::SE2::State start(0, 0, 0);
+    EXPECT_NEAR(3.0,
+        dubins.get_distance(start, statespace::SE2::State(3, 0, 0)), 1e-9);
+    EXPECT_NEAR(M_PI / 2,
+        dubins.get_distance(start, statespace::SE2::State(1, 1, 2)), 1e-9);
+    EXPECT_NEAR(M_PI,
+        dubins.get_distance(start, statespace::SE2::State(0, 2, 4)), 1e-9);
+    EXPECT_NEAR(M_PI,
+        dubins.get_distance(start, statespace::SE2::State(0, -2, 4)), 1e-9);
+    // Driving backwards needs a detour
+    EXPECT_GT(
+        dubins.get_distance(start, statespace::SE2::State(-3, 0, 0)), 3.0);
+
+    // Checking invalid arguments
+    EXPECT_THROW(
+        distance::Dubins(nullptr, 1.0), std::invalid_argument);
+    EXPECT_THROW(
+        distance::Dubins(statespace, 0.0), std::invalid_argument);
+    EXPECT_THROW(
+        distance::Dubins(statespace, 1.0, -1), std::invalid_argument);
+}
+
+TEST(DistanceTest, TestReedsShepp) {
+    // Checking known Reeds-Shepp path lengths for a unit turning radius
+    const auto statespace = std::make_shared<statespace::SE2>(1.0, 8);
+    const distance::ReedsShepp reeds_shepp(statespace, 1.0, 4);
+    const statespace::SE2::State start(0, 0, 0);
+    EXPECT_NEAR(3.0,
+        reeds_shepp.get_distance(start, statespace::SE2::State(3, 0, 0)),
+        1e-9);
+    EXPECT_NEAR(3.0,
+        reeds_shepp.get_distance(start, statespace::SE2::State(-3, 0, 0)),
+        1e-9);
+    EXPECT_NEAR(M_PI / 2,
+        reeds_shepp.get_distance(start, statespace::SE2::State(1, 1, 2)),
+        1e-9);
+    EXPECT_NEAR(M_PI / 2,
+        reeds_shepp.get_distance(start, statespace::SE2::State(-1, 1, 6)),
+        1e-9);
+    EXPECT_NEAR(M_PI,
+        reeds_shepp.get_distance(start, statespace::SE2::State(0, 2, 4)),
+        1e-9);
+}
+
+TEST(DistanceTest, TestNonholonomicBounds) {
+    // Checking Reeds-Shepp <= Dubins, both bounded below by translation,
+    // Reeds-Shepp symmetric and table lookups equal to closed form
+    const auto statespace = std::make_shared<statespace::SE2>(0.5, 8);
+    const distance::Translation trans(statespace);
+    const distance::Dubins dubins(statespace, 1.5, 3);
+    const distance::ReedsShepp reeds_shepp(statespace, 1.5, 3);
+    Eigen::MatrixXi states(120, 3);
+    for (int i = 0; i < states.rows(); ++i) {
+        states.row(i) << (i * 7) % 11 - 5, (i * 3) % 9 - 4, (i * 5) % 8;
+    }
+    for (int i = 0; i < states.rows(); ++i) {
+        const statespace::SE2::State state_1(
+            states(i, 0), states(i, 1), states(i, 2));
+        Eigen::VectorXd dubins_distances;
+        Eigen::VectorXd reeds_shepp_distances;
+        dubins.get_distances(state_1, states, &dubins_distances);
+        reeds_shepp.get_distances(state_1, states, &reeds_shepp_distances);
+        for (int j = 0; j < states.rows(); ++j) {
+            const statespace::SE2::State state_2(
+                states(j, 0), states(j, 1), states(j, 2));
+            const double d = dubins.get_distance(state_1, state_2);
+            const double r = reeds_shepp.get_distance(state_1, state_2);
+            EXPECT_TRUE(std::isfinite(d));
+            EXPECT_TRUE(std::isfinite(r));
+            EXPECT_LE(r, d + 1e-9);
+            EXPECT_LE(trans.get_distance(state_1, state_2), r + 1e-9);
+            EXPECT_NEAR(r, reeds_shepp.get_distance(state_2, state_1), 1e-9);
+            EXPECT_DOUBLE_EQ(d, dubins.compute_distance(state_1, state_2));
+            EXPECT_DOUBLE_EQ(
+                r, reeds_shepp.compute_distance(state_1, state_2));
+            EXPECT_DOUBLE_EQ(d, dubins_distances(j));
+            EXPECT_DOUBLE_EQ(r, reeds_shepp_distances(j));
+        }
+    }
+}
+
+TEST(DistanceTest, TestHeading) {
+    // Checking heading distance is the shortest angular difference
+    const auto statespace = std::make_shared<statespace::SE2>(0.1, 8);
+    const distance::Heading heading(statespace);
+    EXPECT_NEAR(
+        M_PI / 2,
+        heading.get_distance(
+            statespace::SE2::State(0, 0, 1),
+            statespace::SE2::State(1, 3, 3)),
+        1e-12);
+    EXPECT_NEAR(
+        M_PI / 2,
+        heading.get_distance(
+            statespace::SE2::State(0, 0, 3),
+            statespace::SE2::State(0, 0, 5)),
+        1e-12);
+    EXPECT_NEAR(
+        M_PI / 4,
+        heading.get_distance(
+            statespace::SE2::State(0, 0, 7),
+            statespace::SE2::State(0, 0, 0)),
+        1e-12);
+    EXPECT_EQ(4, heading.get_bin_distance(2, 6));
+    EXPECT_EQ(1, heading.get_bin_distance(-1, 0));
+
+    // Checking batch distances match the pairwise distances
+    const statespace::SE2::State query(0, 0, 6);
+    Eigen::MatrixXi states(16, 3);
+    for (int i = 0; i < states.rows(); ++i) {
+        states.row(i) << i, -i, i % 8;
+    }
+    Eigen::VectorXd distances;
+    heading.get_distances(query, states, &distances);
+    ASSERT_EQ(states.rows(), distances.size());
+    for (int i = 0; i < states.rows(); ++i) {
+        EXPECT_DOUBLE_EQ(
+            heading.get_distance(
+                query,
+                statespace::SE2::State(
+                    states(i, 0), states(i, 1), states(i, 2))),
+            distances(i));
+    }
+
+    EXPECT_THROW(distance::Heading(nullptr), std::invalid_argument);
+}
+
+TEST(DistanceTest, TestGridHeuristic) {
+    // Checking free space path lengths are octile distances
+    const auto statespace = std::make_shared<statespace::SE2>(0.1, 8);
+    distance::GridHeuristic heuristic(statespace, -10, -10, 10, 10);
+    const statespace::SE2::State goal(2, 1, 3);
+    EXPECT_TRUE(std::isinf(heuristic.get_cost_to_goal(0, 0)));
+    ASSERT_TRUE(heuristic.set_goal(goal));
+    EXPECT_EQ(21 * 21, heuristic.get_num_updated_cells());
+    EXPECT_DOUBLE_EQ(0, heuristic.get_cost_to_goal(2, 1));
+    EXPECT_NEAR(
+        0.1 * (3 + std::sqrt(2.0)), heuristic.get_cost_to_goal(-2, 0), 1e-12);
+    EXPECT_NEAR(
+        0.1 * (2 + 9 * std::sqrt(2.0)),
+        heuristic.get_distance(statespace::SE2::State(-9, 10, 0), goal),
+        1e-12);
+    EXPECT_DOUBLE_EQ(
+        heuristic.get_cost_to_goal(-9, 10),
+        heuristic.get_distance(goal, statespace::SE2::State(-9, 10, 5)));
+    EXPECT_TRUE(std::isinf(heuristic.get_distance(
+        statespace::SE2::State(11, 0, 0), goal)));
+    // Other pairs get the translation distance
+    EXPECT_NEAR(
+        0.5,
+        heuristic.get_distance(
+            statespace::SE2::State(0, 0, 0),
+            statespace::SE2::State(3, 4, 2)),
+        1e-12);
+
+    // Checking a wall with a gap at its top end is walked around
+    for (int y = -10; y < 10; ++y) {
+        EXPECT_TRUE(heuristic.set_occupied(0, y, true));
+    }
+    EXPECT_FALSE(heuristic.set_occupied(0, 11, true));
+    EXPECT_TRUE(heuristic.is_occupied(0, -3));
+    EXPECT_TRUE(heuristic.is_occupied(0, 11));
+    EXPECT_TRUE(std::isinf(heuristic.get_cost_to_goal(0, -3)));
+    // Up to the gap, through it without cutting the wall corners and down
+    // to the goal
+    EXPECT_NEAR(
+        0.1 * (20 + std::sqrt(2.0)),
+        heuristic.get_cost_to_goal(-1, 0),
+        1e-12);
+
+    // Checking repairs after cell changes match a computation from scratch
+    std::srand(1);
+    for (int i = 0; i < 40; ++i) {
+        const int x = std::rand() % 21 - 10;
+        const int y = std::rand() % 21 - 10;
+        heuristic.set_occupied(x, y, !heuristic.is_occupied(x, y));
+        EXPECT_LT(heuristic.get_num_updated_cells(), 21 * 21);
+    }
+    distance::GridHeuristic expected(statespace, -10, -10, 10, 10);
+    for (int x = -10; x <= 10; ++x) {
+        for (int y = -10; y <= 10; ++y) {
+            expected.set_occupied(x, y, heuristic.is_occupied(x, y));
+        }
+    }
+    expected.set_goal(goal);
+    for (int x = -10; x <= 10; ++x) {
+        for (int y = -10; y <= 10; ++y) {
+            const double cost = expected.get_cost_to_goal(x, y);
+            if (std::isinf(cost)) {
+                EXPECT_TRUE(std::isinf(heuristic.get_cost_to_goal(x, y)));
+            } else {
+                EXPECT_NEAR(cost, heuristic.get_cost_to_goal(x, y), 1e-9);
+            }
+        }
+    }
+
+    // Checking batch distances match the pairwise distances
+    Eigen::MatrixXi states(24, 3);
+    for (int i = 0; i < states.rows(); ++i) {
+        states.row(i) << i - 12, (3 * i) % 21 - 10, i % 8;
+    }
+    states.row(5) << goal.X(), goal.Y(), 0;
+    for (const auto& query : {goal, statespace::SE2::State(-4, 6, 1)}) {
+        Eigen::VectorXd distances;
+        heuristic.get_distances(query, states, &distances);
+        ASSERT_EQ(states.rows(), distances.size());
+        for (int i = 0; i < states.rows(); ++i) {
+            EXPECT_EQ(
+                heuristic.get_distance(
+                    query,
+                    statespace::SE2::State(
+                        states(i, 0), states(i, 1), states(i, 2))),
+                distances(i));
+        }
+    }
+
+    EXPECT_FALSE(heuristic.set_goal(statespace::SE2::State(0, 20, 0)));
+    EXPECT_THROW(
+        distance::GridHeuristic(nullptr, 0, 0, 1, 1), std::invalid_argument);
+    EXPECT_THROW(
+        distance::GridHeuristic(statespace, 0, 0, -1, 1),
+        std::invalid_argument);
+}
+
 }  // namespace test
 }  // namespace distance
 }  // namespace libcozmo
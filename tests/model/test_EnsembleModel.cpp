@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "model/EnsembleModel.hpp"
+#include "model/UnicycleModel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+/// Unicycle model whose end states are offset by a constant
+class OffsetModel : public virtual Model {
+ public:
+    OffsetModel(
+        const Eigen::Vector3d& offset,
+        const bool& thread_safe = true,
+        const bool& fail = false) :
+        m_offset(offset), m_thread_safe(thread_safe), m_fail(fail) {}
+
+    bool predict_state(
+        const Eigen::VectorXd& input_action,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override {
+        if (m_fail ||
+            !m_model.predict_state(input_action, input_state, output_state)) {
+            return false;
+        }
+        *output_state += m_offset;
+        return true;
+    }
+
+    bool is_thread_safe() const override {
+        return m_thread_safe;
+    }
+
+ private:
+    const UnicycleModel m_model;
+    const Eigen::Vector3d m_offset;
+    const bool m_thread_safe;
+    const bool m_fail;
+};
+
+/// Model that throws on every prediction
+class ThrowingModel : public virtual Model {
+ public:
+    explicit ThrowingModel(const bool& thread_safe) :
+        m_thread_safe(thread_safe) {}
+
+    bool predict_state(
+        const Eigen::VectorXd&,
+        const Eigen::VectorXd&,
+        Eigen::VectorXd*) const override {
+        throw std::runtime_error("prediction failed");
+    }
+
+    bool is_thread_safe() const override {
+        return m_thread_safe;
+    }
+
+ private:
+    const bool m_thread_safe;
+};
+
+class EnsembleModelTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        actions.resize(4, 3);
+        states.resize(4, 3);
+        for (int i = 0; i < 4; ++i) {
+            actions.row(i) << 1.0, 0.5 * (i + 1), 0.25 * i;
+            states.row(i) << 0.1 * i, 0.2 * i, 1.0;
+        }
+        UnicycleModel().predict_states(actions, states, &expected);
+    }
+
+    Eigen::MatrixXd actions;
+    Eigen::MatrixXd states;
+    Eigen::MatrixXd expected;
+};
+
+TEST_F(EnsembleModelTest, MeanVarianceTest) {
+    EnsembleModel ensemble({
+        std::make_shared<OffsetModel>(Eigen::Vector3d(0.1, 0.0, 0.0)),
+        std::make_shared<OffsetModel>(Eigen::Vector3d(-0.1, 0.0, 0.0)),
+        std::make_shared<OffsetModel>(Eigen::Vector3d(0.0, 0.3, 0.0))},
+        EnsembleModel::MergePolicy::MEAN_VARIANCE, 2);
+    EXPECT_EQ(3, ensemble.size());
+    EXPECT_TRUE(ensemble.is_thread_safe());
+
+    Eigen::MatrixXd output_states;
+    Eigen::MatrixXd output_variances;
+    ASSERT_TRUE(ensemble.predict_distribution(
+        actions, states, &output_states, &output_variances));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_NEAR(expected(i, 0), output_states(i, 0), 1e-9);
+        EXPECT_NEAR(expected(i, 1) + 0.1, output_states(i, 1), 1e-9);
+        EXPECT_NEAR(expected(i, 2), output_states(i, 2), 1e-9);
+        EXPECT_NEAR(0.02 / 3, output_variances(i, 0), 1e-9);
+        EXPECT_NEAR(0.06 / 3, output_variances(i, 1), 1e-9);
+        EXPECT_NEAR(0.0, output_variances(i, 2), 1e-9);
+    }
+
+    Eigen::VectorXd output_state;
+    ASSERT_TRUE(ensemble.predict_state(
+        actions.row(1).transpose(), states.row(1).transpose(),
+        &output_state));
+    EXPECT_NEAR(expected(1, 1) + 0.1, output_state[1], 1e-9);
+}
+
+TEST_F(EnsembleModelTest, MedianTest) {
+    // The outlier is voted out
+    EnsembleModel ensemble({
+        std::make_shared<OffsetModel>(Eigen::Vector3d(0.0, 0.0, 0.0)),
+        std::make_shared<OffsetModel>(Eigen::Vector3d(0.01, 0.0, 0.0)),
+        std::make_shared<OffsetModel>(Eigen::Vector3d(10.0, 0.0, 0.0))},
+        EnsembleModel::MergePolicy::MEDIAN);
+
+    Eigen::MatrixXd output_states;
+    ASSERT_TRUE(ensemble.predict_states(actions, states, &output_states));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_NEAR(expected(i, 0) + 0.01, output_states(i, 0), 1e-9);
+        EXPECT_NEAR(expected(i, 1), output_states(i, 1), 1e-9);
+    }
+}
+
+TEST_F(EnsembleModelTest, OrientationWrapTest) {
+    // Members agreeing up to 2pi near the wrap point average to 0
+    EnsembleModel ensemble({
+        std::make_shared<OffsetModel>(Eigen::Vector3d(0.0, 0.0, 0.1)),
+        std::make_shared<OffsetModel>(
+            Eigen::Vector3d(0.0, 0.0, 2 * M_PI - 0.1))});
+
+    Eigen::MatrixXd output_states;
+    ASSERT_TRUE(ensemble.predict_states(
+        Eigen::RowVector3d(0.0, 1.0, 0.0),
+        Eigen::RowVector3d(0.0, 0.0, 0.0),
+        &output_states));
+    EXPECT_NEAR(0.0, std::sin(output_states(0, 2)), 1e-9);
+    EXPECT_NEAR(1.0, std::cos(output_states(0, 2)), 1e-9);
+}
+
+TEST_F(EnsembleModelTest, FailureAndStatisticsTest) {
+    EnsembleModel ensemble({
+        std::make_shared<OffsetModel>(Eigen::Vector3d(0.0, 0.0, 0.0)),
+        std::make_shared<OffsetModel>(
+            Eigen::Vector3d(0.0, 0.0, 0.0), false),
+        std::make_shared<OffsetModel>(
+            Eigen::Vector3d(5.0, 0.0, 0.0), true, true)});
+    EXPECT_FALSE(ensemble.is_thread_safe());
+
+    // The failed member is left out of the merge
+    Eigen::MatrixXd output_states;
+    ASSERT_TRUE(ensemble.predict_states(actions, states, &output_states));
+    ASSERT_TRUE(ensemble.predict_states(actions, states, &output_states));
+    EXPECT_TRUE(output_states.isApprox(expected));
+
+    const auto statistics = ensemble.get_statistics();
+    ASSERT_EQ(3, statistics.size());
+    for (const auto& member : statistics) {
+        EXPECT_EQ(2, member.num_calls);
+        EXPECT_EQ(8, member.num_samples);
+        EXPECT_GE(member.max_seconds, member.mean_seconds());
+    }
+    EXPECT_EQ(0, statistics[0].num_failures);
+    EXPECT_EQ(2, statistics[2].num_failures);
+
+    ensemble.reset_statistics();
+    EXPECT_EQ(0, ensemble.get_statistics()[0].num_calls);
+
+    // Mismatched batches fail
+    EXPECT_FALSE(ensemble.predict_states(
+        actions, states.topRows(2), &output_states));
+
+    EXPECT_THROW(
+        EnsembleModel(std::vector<std::shared_ptr<Model>>()),
+        std::invalid_argument);
+}
+
+TEST_F(EnsembleModelTest, ThrowingMemberTest) {
+    // The exception reaches the caller whether the member runs on the pool
+    // or on the calling thread
+    for (const bool& thread_safe : {false, true}) {
+        EnsembleModel ensemble({
+            std::make_shared<OffsetModel>(Eigen::Vector3d(0.1, 0.0, 0.0)),
+            std::make_shared<ThrowingModel>(thread_safe),
+            std::make_shared<OffsetModel>(Eigen::Vector3d(-0.1, 0.0, 0.0))},
+            EnsembleModel::MergePolicy::MEAN_VARIANCE, 2);
+        Eigen::MatrixXd output_states;
+        EXPECT_THROW(
+            ensemble.predict_states(actions, states, &output_states),
+            std::runtime_error);
+    }
+}
+
+TEST_F(EnsembleModelTest, ConcurrentCallersTest) {
+    EnsembleModel ensemble({
+        std::make_shared<UnicycleModel>(),
+        std::make_shared<UnicycleModel>()},
+        EnsembleModel::MergePolicy::MEAN_VARIANCE, 2);
+
+    std::vector<std::thread> callers;
+    std::vector<char> success(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        callers.emplace_back([&, t]() {
+            Eigen::MatrixXd output_states;
+            success[t] =
+                ensemble.predict_states(actions, states, &output_states) &&
+                output_states.isApprox(expected);
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    for (const char& result : success) {
+        EXPECT_TRUE(result);
+    }
+    EXPECT_EQ(4, ensemble.get_statistics()[0].num_calls);
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
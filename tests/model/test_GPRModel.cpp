@@ -77,6 +77,61 @@ TEST_F(GPRModelTest, ModelPredictionTest) {
     EXPECT_NEAR(theta, state_output[2], 0.001);
 }
 
+TEST_F(GPRModelTest, BatchPredictionTest) {
+    Eigen::MatrixXd model_input(2, 4);
+    model_input << 30.0, 1.0, -1.0, 0,
+                   30.0, 1.0, -1.0, 0;
+    Eigen::MatrixXd state_input(2, 3);
+    state_input << 1, 1, 0,
+                   2, 3, 1;
+    Eigen::MatrixXd state_output;
+
+    EXPECT_TRUE(
+        m_model.predict_states(model_input, state_input, &state_output));
+    ASSERT_EQ(2, state_output.rows());
+    ASSERT_EQ(3, state_output.cols());
+
+    for (int i = 0; i < 2; ++i) {
+        Eigen::VectorXd expected;
+        EXPECT_TRUE(m_model.predict_state(
+            model_input.row(i).transpose(),
+            state_input.row(i).transpose(),
+            &expected));
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_NEAR(expected[j], state_output(i, j), 0.0001);
+        }
+    }
+}
+
+TEST_F(GPRModelTest, DistributionPredictionTest) {
+    Eigen::MatrixXd model_input(1, 4);
+    model_input << 30.0, 1.0, -1.0, 0;
+    Eigen::MatrixXd state_input(1, 3);
+    state_input << 1, 1, 0;
+    Eigen::MatrixXd state_output;
+    Eigen::MatrixXd variance_output;
+
+    EXPECT_TRUE(m_model.predict_distribution(
+        model_input, state_input, &state_output, &variance_output));
+
+    EXPECT_NEAR(1 + 0.0978534 * cos(-0.0001391), state_output(0, 0), 0.001);
+    EXPECT_NEAR(1 + 0.0978534 * sin(-0.0001391), state_output(0, 1), 0.001);
+    EXPECT_NEAR(-0.0001391, state_output(0, 2), 0.001);
+    for (int j = 0; j < 3; ++j) {
+        EXPECT_GE(variance_output(0, j), 0.0);
+    }
+}
+
+TEST_F(GPRModelTest, BatchPredictionSizeMismatchTest) {
+    Eigen::MatrixXd model_input(2, 4);
+    model_input.setZero();
+    Eigen::MatrixXd state_input(1, 3);
+    state_input.setZero();
+    Eigen::MatrixXd state_output;
+    EXPECT_FALSE(
+        m_model.predict_states(model_input, state_input, &state_output));
+}
+
 }  // namespace test
 }  // namespace model
 }  // namespace libcozmo
@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "model/GPTrainer.hpp"
+#include "model/NativeGPRModel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+class GPTrainerTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        // Noisy pushes whose distance grows with the speed and whose
+        // rotation depends smoothly on the edge offset
+        std::mt19937 generator(3);
+        std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+        std::normal_distribution<double> noise(0.0, 0.002);
+        for (int i = 0; i < 80; ++i) {
+            const double speed = 30.0 + 20.0 * uniform(generator);
+            const double edge_offset = uniform(generator);
+            Eigen::VectorXd action(4);
+            action << speed, 1.0 + 0.5 * (i % 2), edge_offset, 0.0;
+            const double distance = speed / 100.0 + noise(generator);
+            const double dtheta =
+                0.2 * std::sin(2.0 * edge_offset) + noise(generator);
+            const Eigen::Vector3d start(1.0, 2.0, 0.0);
+            const Eigen::Vector3d end(
+                start[0] + distance * cos(start[2] + dtheta),
+                start[1] + distance * sin(start[2] + dtheta),
+                start[2] + dtheta);
+            dataset.add_sample(action, start, end);
+        }
+        inputs = GPModel::get_inputs(dataset.actions());
+        targets = GPModel::get_targets(
+            dataset.start_states(), dataset.end_states());
+    }
+
+    Dataset dataset;
+    Eigen::MatrixXd inputs;
+    Eigen::MatrixXd targets;
+};
+
+TEST_F(GPTrainerTest, GradientTest) {
+    // Analytic gradients match central finite differences
+    const Eigen::MatrixXd normalized = (targets.rowwise() -
+        targets.colwise().mean()).array().rowwise() /
+        Eigen::RowVector2d(0.1, 0.1).array();
+    const std::vector<KernelType> kernel_types{
+        KernelType::RBF, KernelType::MATERN_3_2, KernelType::MATERN_5_2};
+    for (const auto& kernel_type : kernel_types) {
+        for (const int num_length_scales : {1, 3}) {
+            Eigen::VectorXd x(num_length_scales + 2);
+            x.head(num_length_scales).setConstant(std::log(0.8));
+            x[0] = std::log(15.0);
+            x[num_length_scales] = std::log(1.3);
+            x[num_length_scales + 1] = std::log(0.05);
+
+            double value;
+            Eigen::VectorXd gradient;
+            ASSERT_TRUE(GPTrainer::log_marginal_likelihood(
+                kernel_type, inputs, normalized, x, &value, &gradient));
+            for (int i = 0; i < x.size(); ++i) {
+                const double h = 1e-5;
+                Eigen::VectorXd x_plus = x;
+                Eigen::VectorXd x_minus = x;
+                x_plus[i] += h;
+                x_minus[i] -= h;
+                double value_plus;
+                double value_minus;
+                ASSERT_TRUE(GPTrainer::log_marginal_likelihood(
+                    kernel_type, inputs, normalized, x_plus, &value_plus,
+                    nullptr));
+                ASSERT_TRUE(GPTrainer::log_marginal_likelihood(
+                    kernel_type, inputs, normalized, x_minus, &value_minus,
+                    nullptr));
+                EXPECT_NEAR(
+                    (value_plus - value_minus) / (2 * h), gradient[i],
+                    1e-4 * (1.0 + std::abs(gradient[i])));
+            }
+        }
+    }
+}
+
+TEST_F(GPTrainerTest, TrainAndExportTest) {
+    GPTrainer::Parameters parameters;
+    parameters.kernel_type = KernelType::MATERN_5_2;
+    parameters.num_restarts = 4;
+    GPTrainer trainer(parameters, 2);
+
+    GPParameters model;
+    GPTrainer::Result result;
+    ASSERT_TRUE(trainer.train(dataset, &model, &result));
+    EXPECT_EQ(80, result.num_samples);
+    ASSERT_EQ(4, result.restart_log_marginal_likelihoods.size());
+    for (const double& value : result.restart_log_marginal_likelihoods) {
+        EXPECT_LE(value, result.log_marginal_likelihood);
+    }
+    EXPECT_EQ(3, model.length_scales.size());
+    EXPECT_EQ(80, model.cholesky.rows());
+
+    // The trained model is better than the default hyperparameters
+    const Eigen::MatrixXd normalized = ((targets.rowwise() -
+        model.target_mean.transpose()).array().rowwise() /
+        model.target_scale.transpose().array()).matrix();
+    Eigen::VectorXd defaults(5);
+    defaults << std::log(10.0), 0.0, 0.0, 0.0, std::log(0.1);
+    double default_value;
+    ASSERT_TRUE(GPTrainer::log_marginal_likelihood(
+        KernelType::MATERN_5_2, inputs, normalized, defaults,
+        &default_value, nullptr));
+    EXPECT_GT(result.log_marginal_likelihood, default_value);
+
+    // The exported model reproduces the training pushes
+    const std::string path = "test_gp_trainer.gp";
+    ASSERT_TRUE(ModelFile::write(path, model));
+    NativeGPRModel native(path);
+    Eigen::MatrixXd output_states;
+    ASSERT_TRUE(native.predict_states(
+        dataset.actions(), dataset.start_states(), &output_states));
+    EXPECT_LT(
+        (output_states - dataset.end_states()).cwiseAbs().maxCoeff(), 0.01);
+    std::remove(path.c_str());
+}
+
+TEST_F(GPTrainerTest, SubsampleAndIsotropicTest) {
+    GPTrainer::Parameters parameters;
+    parameters.isotropic = true;
+    parameters.max_samples = 40;
+    parameters.num_restarts = 2;
+    GPTrainer trainer(parameters);
+
+    GPParameters model;
+    GPTrainer::Result result;
+    ASSERT_TRUE(trainer.train(inputs, targets, &model, &result));
+    EXPECT_EQ(40, result.num_samples);
+    EXPECT_EQ(40, model.inputs.rows());
+    EXPECT_EQ(1, model.length_scales.size());
+
+    EXPECT_FALSE(trainer.train(inputs, targets.topRows(3), &model));
+
+    parameters.num_restarts = 0;
+    EXPECT_THROW(GPTrainer trainer(parameters), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
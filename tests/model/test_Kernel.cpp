@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include "model/Kernel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+TEST(KernelTest, RBFEvaluationTest) {
+    RBFKernel kernel(Eigen::VectorXd::Constant(1, 0.5), 2.0);
+    const Eigen::Vector3d x1(0.0, 0.0, 0.0);
+    const Eigen::Vector3d x2(0.5, 0.0, 0.0);
+    EXPECT_NEAR(2.0, kernel.evaluate(x1, x1), 1e-12);
+    EXPECT_NEAR(2.0 * exp(-0.5), kernel.evaluate(x1, x2), 1e-12);
+}
+
+TEST(KernelTest, ARDEvaluationTest) {
+    RBFKernel kernel(Eigen::Vector2d(1.0, 2.0), 1.0);
+    EXPECT_NEAR(
+        exp(-0.5 * (1.0 + 1.0)),
+        kernel.evaluate(Eigen::Vector2d(0, 0), Eigen::Vector2d(1, 2)),
+        1e-12);
+}
+
+TEST(KernelTest, MaternEvaluationTest) {
+    MaternKernel kernel_3_2(Eigen::VectorXd::Constant(1, 1.0), 1.0, 1.5);
+    MaternKernel kernel_5_2(Eigen::VectorXd::Constant(1, 1.0), 1.0, 2.5);
+    const Eigen::Vector2d x1(0.0, 0.0);
+    const Eigen::Vector2d x2(0.3, 0.4);
+    const double r = 0.5;
+    EXPECT_NEAR(
+        (1 + sqrt(3) * r) * exp(-sqrt(3) * r),
+        kernel_3_2.evaluate(x1, x2),
+        1e-12);
+    EXPECT_NEAR(
+        (1 + sqrt(5) * r + 5 * r * r / 3) * exp(-sqrt(5) * r),
+        kernel_5_2.evaluate(x1, x2),
+        1e-12);
+    EXPECT_NEAR(1.0, kernel_5_2.evaluate(x1, x1), 1e-12);
+}
+
+TEST(KernelTest, CovarianceMatrixTest) {
+    RBFKernel kernel(Eigen::Vector3d(0.3, 1.0, 2.0), 1.5);
+    Eigen::MatrixXd inputs_1(2, 3);
+    inputs_1 << 0.1, 0.2, 0.3,
+                -1.0, 2.0, 0.5;
+    Eigen::MatrixXd inputs_2(3, 3);
+    inputs_2 << 0.0, 0.0, 0.0,
+                0.1, 0.2, 0.3,
+                1.0, -1.0, 2.0;
+    Eigen::MatrixXd covariance;
+    kernel.compute(inputs_1, inputs_2, &covariance);
+    ASSERT_EQ(2, covariance.rows());
+    ASSERT_EQ(3, covariance.cols());
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_NEAR(
+                kernel.evaluate(
+                    inputs_1.row(i).transpose(), inputs_2.row(j).transpose()),
+                covariance(i, j),
+                1e-12);
+        }
+    }
+    EXPECT_NEAR(1.5, covariance(0, 1), 1e-12);
+}
+
+TEST(KernelTest, ThrowingExceptionTest) {
+    EXPECT_THROW(
+        RBFKernel(Eigen::VectorXd::Constant(1, 0.0), 1.0),
+        std::invalid_argument);
+    EXPECT_THROW(
+        RBFKernel(Eigen::VectorXd::Constant(1, 1.0), -1.0),
+        std::invalid_argument);
+    EXPECT_THROW(
+        MaternKernel(Eigen::VectorXd::Constant(1, 1.0), 1.0, 0.5),
+        std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
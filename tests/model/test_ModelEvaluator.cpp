@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "model/Dataset.hpp"
+#include "model/ModelEvaluator.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+/// Model that predicts the start state shifted by the action speed along x
+/// and rotated by the heading offset; fails for negative speeds
+class ShiftModel : public virtual Model {
+ public:
+    bool predict_state(
+        const Eigen::VectorXd& input_action,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override {
+        if (input_action[0] < 0) {
+            return false;
+        }
+        *output_state = input_state;
+        (*output_state)[0] += input_action[0];
+        (*output_state)[2] += input_action[3];
+        return true;
+    }
+};
+
+class ModelEvaluatorTest : public ::testing::Test {
+ protected:
+    void SetUp() override {
+        // Observed end states are 0.01 * i away from the prediction in
+        // position and 0.001 * i in heading; headings wrap around
+        const int size = 1000;
+        Eigen::MatrixXd actions(size, 4);
+        Eigen::MatrixXd start_states(size, 3);
+        Eigen::MatrixXd end_states(size, 3);
+        for (int i = 0; i < size; ++i) {
+            actions.row(i) << 1.0, 1.0, 0.0, 0.0;
+            start_states.row(i) << i, -i, 2 * M_PI - 0.0005 * i;
+            end_states.row(i) << i + 1.0, -i + 0.01 * i, 0.0005 * i;
+        }
+        dataset = Dataset(actions, start_states, end_states);
+    }
+
+    Dataset dataset;
+};
+
+TEST_F(ModelEvaluatorTest, ErrorStatisticsTest) {
+    ModelEvaluator evaluator(
+        {std::make_shared<ShiftModel>()}, {"shift"}, 3);
+    evaluator.evaluate(dataset);
+
+    const auto reports = evaluator.get_reports();
+    ASSERT_EQ(1, reports.size());
+    const auto& report = reports[0];
+    EXPECT_EQ("shift", report.name);
+    EXPECT_EQ(1000, report.num_samples);
+    EXPECT_EQ(0, report.num_failures);
+    EXPECT_GT(report.samples_per_second, 0.0);
+
+    EXPECT_NEAR(4.995, report.position_error.mean, 1e-9);
+    EXPECT_NEAR(4.99, report.position_error.median, 1e-9);
+    EXPECT_NEAR(8.99, report.position_error.percentile_90, 1e-9);
+    EXPECT_NEAR(9.89, report.position_error.percentile_99, 1e-9);
+    EXPECT_NEAR(9.99, report.position_error.max, 1e-9);
+    EXPECT_NEAR(
+        std::sqrt(0.0001 * 999 * 1000 * 1999 / 6 / 1000),
+        report.position_error.rmse, 1e-9);
+    EXPECT_NEAR(0.4995, report.heading_error.mean, 1e-9);
+    EXPECT_NEAR(0.999, report.heading_error.max, 1e-9);
+
+    evaluator.reset();
+    EXPECT_EQ(0, evaluator.get_reports()[0].num_samples);
+    EXPECT_EQ(0.0, evaluator.get_reports()[0].position_error.max);
+}
+
+TEST_F(ModelEvaluatorTest, FailureTest) {
+    Eigen::MatrixXd actions = dataset.actions();
+    actions(0, 0) = -1.0;
+    ModelEvaluator evaluator(
+        {std::make_shared<ShiftModel>()}, {"shift"}, 1);
+    evaluator.evaluate(
+        Dataset(actions, dataset.start_states(), dataset.end_states()));
+
+    // The whole batch of the failed sample is counted as failed
+    const auto report = evaluator.get_reports()[0];
+    EXPECT_EQ(1000, report.num_samples);
+    EXPECT_LT(0, report.num_failures);
+    EXPECT_GT(1000, report.num_failures);
+
+    EXPECT_THROW(
+        ModelEvaluator({std::make_shared<ShiftModel>()}, {}),
+        std::invalid_argument);
+}
+
+TEST_F(ModelEvaluatorTest, FileStreamingTest) {
+    const std::string path = "test_model_evaluator_dataset.csv";
+    std::ofstream file(path);
+    file << "# speed, aspect_ratio, edge_offset, heading_offset, ..."
+         << std::endl;
+    file.precision(17);
+    for (int i = 0; i < dataset.size(); ++i) {
+        file << dataset.actions().row(i).format(Eigen::IOFormat(
+                    Eigen::FullPrecision, 0, ",", ","))
+             << "," << dataset.start_states().row(i).format(Eigen::IOFormat(
+                    Eigen::FullPrecision, 0, ",", ","))
+             << "," << dataset.end_states().row(i).format(Eigen::IOFormat(
+                    Eigen::FullPrecision, 0, ",", ","))
+             << std::endl;
+    }
+    file.close();
+
+    // Chunks are read in order
+    DatasetReader reader(path);
+    Dataset chunk;
+    ASSERT_TRUE(reader.read(300, &chunk));
+    EXPECT_EQ(300, chunk.size());
+    ASSERT_TRUE(reader.read(800, &chunk));
+    EXPECT_EQ(700, chunk.size());
+    EXPECT_NEAR(300, chunk.start_states()(0, 0), 1e-12);
+    EXPECT_FALSE(reader.read(300, &chunk));
+    EXPECT_EQ(0, chunk.size());
+
+    ModelEvaluator evaluator(
+        {std::make_shared<ShiftModel>(), std::make_shared<ShiftModel>()},
+        {"a", "b"});
+    EXPECT_EQ(1000, evaluator.evaluate_file(path, 128));
+    for (const auto& report : evaluator.get_reports()) {
+        EXPECT_EQ(1000, report.num_samples);
+        EXPECT_NEAR(4.995, report.position_error.mean, 1e-9);
+        EXPECT_NEAR(9.99, report.position_error.max, 1e-9);
+    }
+    std::remove(path.c_str());
+
+    EXPECT_THROW(
+        evaluator.evaluate_file("does_not_exist.csv"), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
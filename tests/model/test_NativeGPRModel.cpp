@@ -0,0 +1,204 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include "model/ModelFile.hpp"
+#include "model/NativeGPRModel.hpp"
+#include "model/OnlineGPRModel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+class NativeGPRModelTest: public ::testing::Test {
+ public:
+    NativeGPRModelTest() :
+        m_path("test_native_gpr_model.gp"),
+        m_kernel(std::make_shared<RBFKernel>(
+            Eigen::Vector3d(20.0, 0.5, 1.0), 1.5)),
+        m_reference(m_kernel, 1e-3, 100) {}
+
+    void SetUp() {
+        // Fits an exact GP and stores it in a model file
+        Dataset dataset;
+        for (int i = 0; i < 30; ++i) {
+            const double speed = 10.0 + (i % 5) * 10.0;
+            const double edge_offset = -1.0 + (i % 7) * 2.0 / 6.0;
+            Eigen::VectorXd action(4);
+            action << speed, 1.0, edge_offset, 0.0;
+            const double distance = speed / 100.0;
+            const double dtheta = edge_offset / 10.0;
+            const Eigen::Vector3d start(0.0, 0.0, 0.0);
+            const Eigen::Vector3d end(
+                distance * cos(dtheta), distance * sin(dtheta), dtheta);
+            dataset.add_sample(action, start, end);
+        }
+        m_reference.add_samples(dataset);
+
+        GPParameters parameters;
+        parameters.kernel_type = KernelType::RBF;
+        parameters.length_scales = m_kernel->length_scales();
+        parameters.signal_variance = m_kernel->signal_variance();
+        parameters.noise_variance = 1e-3;
+        parameters.inputs = GPModel::get_inputs(dataset.actions());
+        Eigen::MatrixXd K;
+        m_kernel->compute(parameters.inputs, parameters.inputs, &K);
+        K.diagonal().array() += 1e-3;
+        const Eigen::LLT<Eigen::MatrixXd> llt(K);
+        parameters.weights = llt.solve(GPModel::get_targets(
+            dataset.start_states(), dataset.end_states()));
+        parameters.cholesky = llt.matrixL();
+        parameters.target_mean = Eigen::Vector2d::Zero();
+        parameters.target_scale = Eigen::Vector2d::Ones();
+        ASSERT_TRUE(ModelFile::write(m_path, parameters));
+    }
+
+    void TearDown() {
+        std::remove(m_path.c_str());
+    }
+
+    const std::string m_path;
+    std::shared_ptr<Kernel> m_kernel;
+    OnlineGPRModel m_reference;
+};
+
+TEST_F(NativeGPRModelTest, ModelFileTest) {
+    ModelFile file(m_path);
+    EXPECT_EQ(ModelFile::kVersion, file.header().version);
+    EXPECT_EQ(ModelFile::kByteOrderMark, file.header().byte_order);
+    EXPECT_EQ(30u, file.header().num_samples);
+    EXPECT_EQ(3u, file.header().input_size);
+    EXPECT_EQ(2u, file.header().output_size);
+    EXPECT_EQ(30, file.cholesky().rows());
+    EXPECT_NEAR(1.5, file.kernel()->signal_variance(), 1e-12);
+    EXPECT_NEAR(0.5, file.length_scales()[1], 1e-12);
+    EXPECT_NEAR(20.0, file.inputs()(1, 0), 1e-12);
+}
+
+TEST_F(NativeGPRModelTest, MatchesExactGPTest) {
+    NativeGPRModel model(m_path);
+
+    Eigen::MatrixXd actions(3, 4);
+    actions << 25.0, 1.0, 0.1, 0.0,
+               42.0, 1.0, -0.6, 0.0,
+               10.0, 1.0, 1.0, 0.0;
+    Eigen::MatrixXd states(3, 3);
+    states << 1.0, 2.0, 0.5,
+              0.0, 0.0, 0.0,
+              -1.0, 0.5, 3.0;
+
+    Eigen::MatrixXd expected_states, expected_variances;
+    ASSERT_TRUE(m_reference.predict_distribution(
+        actions, states, &expected_states, &expected_variances));
+    Eigen::MatrixXd output_states, output_variances;
+    ASSERT_TRUE(model.predict_distribution(
+        actions, states, &output_states, &output_variances));
+    EXPECT_TRUE(output_states.isApprox(expected_states, 1e-6));
+    EXPECT_TRUE(output_variances.isApprox(expected_variances, 1e-4));
+
+    Eigen::VectorXd output_state;
+    ASSERT_TRUE(model.predict_state(
+        actions.row(0).transpose(), states.row(0).transpose(),
+        &output_state));
+    EXPECT_NEAR(expected_states(0, 0), output_state[0], 1e-6);
+}
+
+TEST_F(NativeGPRModelTest, InvalidFileTest) {
+    EXPECT_THROW(NativeGPRModel("does_not_exist.gp"), std::invalid_argument);
+
+    const std::string path = "test_native_gpr_invalid.gp";
+    std::ofstream file(path, std::ios::binary);
+    file << "not a model file, but long enough to hold a header";
+    file.close();
+    EXPECT_THROW(NativeGPRModel(path.c_str()), std::invalid_argument);
+    std::remove(path.c_str());
+}
+
+TEST_F(NativeGPRModelTest, InvalidHeaderTest) {
+    std::ifstream input(m_path, std::ios::binary);
+    const std::string contents(
+        (std::istreambuf_iterator<char>(input)),
+        std::istreambuf_iterator<char>());
+    input.close();
+
+    // Rewrites the valid file with a modified header and size
+    const std::string path = "test_native_gpr_header.gp";
+    auto write_file = [&contents, &path](
+        const ModelFile::Header& header, const size_t& size) {
+        std::string modified = contents;
+        std::memcpy(&modified[0], &header, sizeof(header));
+        modified.resize(size);
+        std::ofstream file(path, std::ios::binary);
+        file << modified;
+    };
+    ModelFile::Header header;
+    std::memcpy(&header, contents.data(), sizeof(header));
+
+    // Byte swapped
+    ModelFile::Header swapped = header;
+    swapped.byte_order = 0x04030201;
+    write_file(swapped, contents.size());
+    EXPECT_THROW(ModelFile file(path), std::invalid_argument);
+
+    // Length scales neither shared nor one per input dimension, with a file
+    // size that matches the header
+    ModelFile::Header length_scales = header;
+    length_scales.num_length_scales = 2;
+    write_file(length_scales, contents.size() - sizeof(double));
+    EXPECT_THROW(ModelFile file(path), std::invalid_argument);
+    std::remove(path.c_str());
+
+    // The writer rejects such parameters too
+    GPParameters parameters;
+    parameters.kernel_type = KernelType::RBF;
+    parameters.length_scales = Eigen::Vector2d(1.0, 1.0);
+    parameters.signal_variance = 1.0;
+    parameters.noise_variance = 1e-3;
+    parameters.inputs = Eigen::MatrixXd::Zero(4, 3);
+    parameters.weights = Eigen::MatrixXd::Zero(4, 2);
+    parameters.target_mean = Eigen::Vector2d::Zero();
+    parameters.target_scale = Eigen::Vector2d::Ones();
+    EXPECT_FALSE(ModelFile::write(path, parameters));
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,230 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include "model/OnlineGPRModel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+/// Invalid covariance function where distinct inputs are more correlated than
+/// an input with itself, so distinct samples can never be added together
+class CorrelatedKernel : public Kernel {
+ public:
+    CorrelatedKernel() : Kernel(Eigen::VectorXd::Ones(1), 1.0) {}
+
+ protected:
+    void profile(Eigen::ArrayXXd* values) const override {
+        *values = (*values > 1e-6).select(2.0 * m_signal_variance,
+            Eigen::ArrayXXd::Constant(
+                values->rows(), values->cols(), m_signal_variance));
+    }
+
+    void profile_derivative(Eigen::ArrayXXd* values) const override {
+        values->setZero();
+    }
+};
+
+class OnlineGPRModelTest: public ::testing::Test {
+ public:
+    OnlineGPRModelTest() :
+        m_kernel(std::make_shared<RBFKernel>(
+            Eigen::Vector3d(20.0, 0.5, 1.0), 1.0)),
+        m_model(m_kernel, 1e-3, 10) {}
+
+    /// Generates a push where the object moves speed * gain / 100 along the
+    /// pushing direction and rotates by the edge offset / 10
+    void generate_sample(
+        const int& i,
+        const double& gain,
+        Eigen::VectorXd* action,
+        Eigen::VectorXd* start,
+        Eigen::VectorXd* end) {
+        const double speed = 10.0 + (i % 5) * 10.0;
+        const double edge_offset = -1.0 + (i % 7) * 2.0 / 6.0;
+        action->resize(4);
+        *action << speed, 1.0, edge_offset, 0.0;
+        const double distance = gain * speed / 100.0;
+        const double dtheta = edge_offset / 10.0;
+        start->resize(3);
+        *start << 0.1 * i, 0.2, 0.3;
+        end->resize(3);
+        *end << (*start)[0] + distance * cos(dtheta),
+                (*start)[1] + distance * sin(dtheta),
+                (*start)[2] + dtheta;
+    }
+
+    /// Fits an exact GP from scratch on the given samples and predicts the
+    /// targets of the query inputs
+    void exact_prediction(
+        const Dataset& dataset,
+        const Eigen::MatrixXd& query_inputs,
+        Eigen::MatrixXd* means,
+        Eigen::VectorXd* variances) {
+        const Eigen::MatrixXd inputs = GPModel::get_inputs(dataset.actions());
+        const Eigen::MatrixXd targets = GPModel::get_targets(
+            dataset.start_states(), dataset.end_states());
+        Eigen::MatrixXd K;
+        m_kernel->compute(inputs, inputs, &K);
+        K.diagonal().array() += 1e-3;
+        const Eigen::LLT<Eigen::MatrixXd> llt(K);
+        Eigen::MatrixXd K_s;
+        m_kernel->compute(query_inputs, inputs, &K_s);
+        *means = K_s * llt.solve(targets);
+        *variances = (1.0 -
+            (K_s * llt.solve(K_s.transpose())).diagonal().array()).matrix();
+    }
+
+    std::shared_ptr<Kernel> m_kernel;
+    OnlineGPRModel m_model;
+};
+
+TEST_F(OnlineGPRModelTest, EmptyModelTest) {
+    Eigen::VectorXd output_state;
+    EXPECT_EQ(0, m_model.size());
+    EXPECT_FALSE(m_model.predict_state(
+        Eigen::Vector4d(10, 1, 0, 0), Eigen::Vector3d(0, 0, 0),
+        &output_state));
+}
+
+TEST_F(OnlineGPRModelTest, MatchesRefitTest) {
+    // Add more samples than fit in the window so the oldest are dropped
+    Dataset window;
+    Eigen::VectorXd action, start, end;
+    for (int i = 0; i < 25; ++i) {
+        generate_sample(i, 1.0, &action, &start, &end);
+        ASSERT_TRUE(m_model.add_sample(action, start, end));
+        if (i >= 15) {
+            window.add_sample(action, start, end);
+        }
+    }
+    EXPECT_EQ(10, m_model.size());
+    EXPECT_EQ(10, m_model.max_samples());
+
+    Eigen::MatrixXd query(3, 4);
+    query << 25.0, 1.0, 0.1, 0.0,
+             42.0, 1.0, -0.6, 0.0,
+             10.0, 1.0, 1.0, 0.0;
+    Eigen::MatrixXd expected_means;
+    Eigen::VectorXd expected_variances;
+    exact_prediction(
+        window, GPModel::get_inputs(query),
+        &expected_means, &expected_variances);
+
+    Eigen::MatrixXd states = Eigen::MatrixXd::Zero(3, 3);
+    Eigen::MatrixXd output_states, output_variances;
+    ASSERT_TRUE(m_model.predict_distribution(
+        query, states, &output_states, &output_variances));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_NEAR(expected_means(i, 1), output_states(i, 2), 1e-6);
+        EXPECT_NEAR(
+            expected_means(i, 0) * cos(expected_means(i, 1)),
+            output_states(i, 0),
+            1e-6);
+        EXPECT_NEAR(expected_variances[i], output_variances(i, 2), 1e-6);
+    }
+}
+
+TEST_F(OnlineGPRModelTest, AdaptsToDriftTest) {
+    Eigen::VectorXd action, start, end;
+    for (int i = 0; i < 10; ++i) {
+        generate_sample(i, 1.0, &action, &start, &end);
+        m_model.add_sample(action, start, end);
+    }
+    Eigen::VectorXd output_state;
+    const Eigen::Vector4d query(30.0, 1.0, -1.0 / 3.0, 0.0);
+    const Eigen::Vector3d query_state(0, 0, 0);
+    ASSERT_TRUE(m_model.predict_state(query, query_state, &output_state));
+    EXPECT_NEAR(0.3, output_state[0], 0.01);
+
+    // Surface friction changes so pushes travel half as far
+    for (int i = 0; i < 10; ++i) {
+        generate_sample(i, 0.5, &action, &start, &end);
+        m_model.add_sample(action, start, end);
+    }
+    ASSERT_TRUE(m_model.predict_state(query, query_state, &output_state));
+    EXPECT_NEAR(0.15, output_state[0], 0.01);
+}
+
+TEST_F(OnlineGPRModelTest, DatasetAndClearTest) {
+    Dataset dataset;
+    Eigen::VectorXd action, start, end;
+    for (int i = 0; i < 5; ++i) {
+        generate_sample(i, 1.0, &action, &start, &end);
+        dataset.add_sample(action, start, end);
+    }
+    EXPECT_TRUE(m_model.add_samples(dataset));
+    EXPECT_EQ(5, m_model.size());
+    m_model.clear();
+    EXPECT_EQ(0, m_model.size());
+}
+
+TEST_F(OnlineGPRModelTest, RejectedSampleKeepsWindowTest) {
+    OnlineGPRModel model(std::make_shared<CorrelatedKernel>(), 1e-3, 2);
+    Eigen::VectorXd action, start, end;
+    generate_sample(0, 1.0, &action, &start, &end);
+    ASSERT_TRUE(model.add_sample(action, start, end));
+    ASSERT_TRUE(model.add_sample(action, start, end));
+    EXPECT_EQ(2, model.size());
+
+    Eigen::VectorXd expected_state;
+    const Eigen::Vector3d query_state(0, 0, 0);
+    ASSERT_TRUE(model.predict_state(action, query_state, &expected_state));
+
+    // The full window keeps its oldest sample when the new one is rejected
+    Eigen::VectorXd other_action, other_start, other_end;
+    generate_sample(1, 1.0, &other_action, &other_start, &other_end);
+    EXPECT_FALSE(model.add_sample(other_action, other_start, other_end));
+    EXPECT_EQ(2, model.size());
+    Eigen::VectorXd output_state;
+    ASSERT_TRUE(model.predict_state(action, query_state, &output_state));
+    EXPECT_TRUE(expected_state.isApprox(output_state));
+
+    // Accepted samples still replace the oldest one
+    EXPECT_TRUE(model.add_sample(action, start, end));
+    EXPECT_EQ(2, model.size());
+}
+
+TEST_F(OnlineGPRModelTest, ThrowingExceptionTest) {
+    EXPECT_THROW(OnlineGPRModel(nullptr, 1e-3, 10), std::invalid_argument);
+    EXPECT_THROW(OnlineGPRModel(m_kernel, -1.0, 10), std::invalid_argument);
+    EXPECT_THROW(OnlineGPRModel(m_kernel, 1e-3, 0), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
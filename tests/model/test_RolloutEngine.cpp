@@ -0,0 +1,144 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+#include "actionspace/GenericActionSpace.hpp"
+#include "model/RolloutEngine.hpp"
+#include "model/UnicycleModel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+/// Unicycle model that must only be called from one thread
+class SerialModel : public UnicycleModel {
+ public:
+    bool is_thread_safe() const override {
+        return false;
+    }
+};
+
+class RolloutEngineTest : public ::testing::Test {
+ protected:
+    RolloutEngineTest() :
+        actionspace(
+            std::vector<double>{0.5, 1.0}, std::vector<double>{1.0, 2.0}, 8) {}
+
+    void SetUp() override {
+        action_ids.resize(37, 5);
+        for (int k = 0; k < action_ids.rows(); ++k) {
+            for (int t = 0; t < action_ids.cols(); ++t) {
+                action_ids(k, t) = (7 * k + 3 * t) % actionspace.size();
+            }
+        }
+    }
+
+    /// Checks the rollouts against sequential single state predictions
+    void check(const Eigen::MatrixXd& start_states, const Rollouts& rollouts) {
+        ASSERT_EQ(action_ids.rows(), rollouts.num_sequences);
+        ASSERT_EQ(action_ids.cols(), rollouts.horizon);
+        ASSERT_EQ(3, rollouts.state_size);
+        for (int k = 0; k < action_ids.rows(); ++k) {
+            Eigen::VectorXd state = start_states.row(k).transpose();
+            EXPECT_TRUE(rollouts.state(k, 0).isApprox(state));
+            for (int t = 0; t < action_ids.cols(); ++t) {
+                Eigen::VectorXd next_state;
+                ASSERT_TRUE(model.predict_state(
+                    actionspace.get_action(action_ids(k, t))->vector(),
+                    state,
+                    &next_state));
+                state = next_state;
+                EXPECT_TRUE(rollouts.state(k, t + 1).isApprox(state, 1e-12));
+            }
+        }
+    }
+
+    actionspace::GenericActionSpace actionspace;
+    UnicycleModel model;
+    Eigen::MatrixXi action_ids;
+};
+
+TEST_F(RolloutEngineTest, SharedStartTest) {
+    RolloutEngine engine(std::make_shared<UnicycleModel>(), actionspace, 3);
+    ASSERT_EQ(actionspace.size(), engine.action_vectors().rows());
+
+    Rollouts rollouts;
+    const Eigen::Vector3d start(1.0, -2.0, 0.5);
+    ASSERT_TRUE(engine.rollout(start, action_ids, &rollouts));
+    check(start.transpose().replicate(action_ids.rows(), 1), rollouts);
+
+    // Timesteps are contiguous batches of all sequences
+    EXPECT_EQ(
+        rollouts.data.data() + 2 * 3 * action_ids.rows(),
+        rollouts.timestep(2).data());
+}
+
+TEST_F(RolloutEngineTest, PerSequenceStartTest) {
+    RolloutEngine engine(std::make_shared<SerialModel>(), actionspace);
+
+    Eigen::MatrixXd starts(action_ids.rows(), 3);
+    for (int k = 0; k < starts.rows(); ++k) {
+        starts.row(k) << 0.1 * k, -0.3 * k, 0.2 * k;
+    }
+    Rollouts rollouts;
+    ASSERT_TRUE(engine.rollout_from_states(starts, action_ids, &rollouts));
+    check(starts, rollouts);
+}
+
+TEST_F(RolloutEngineTest, InvalidInputTest) {
+    RolloutEngine engine(std::make_shared<UnicycleModel>(), actionspace, 2);
+    Rollouts rollouts;
+
+    action_ids(3, 2) = actionspace.size();
+    EXPECT_FALSE(engine.rollout(
+        Eigen::Vector3d(0.0, 0.0, 0.0), action_ids, &rollouts));
+    action_ids(3, 2) = -1;
+    EXPECT_FALSE(engine.rollout(
+        Eigen::Vector3d(0.0, 0.0, 0.0), action_ids, &rollouts));
+
+    // Wrong state size is rejected by the model
+    action_ids(3, 2) = 0;
+    EXPECT_FALSE(engine.rollout(
+        Eigen::Vector2d(0.0, 0.0), action_ids, &rollouts));
+
+    EXPECT_THROW(
+        RolloutEngine(std::shared_ptr<Model>(), actionspace),
+        std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include "model/Dataset.hpp"
+#include "model/SparseGPRModel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+class SparseGPRModelTest: public ::testing::Test {
+ public:
+    SparseGPRModelTest() :
+        m_kernel(std::make_shared<RBFKernel>(
+            Eigen::VectorXd::Constant(1, 0.5), 1.0)),
+        m_model(m_kernel, 1e-4) {}
+
+    void SetUp() {
+        // Pushes where the object moves speed / 100 along the pushing
+        // direction and rotates by the edge offset / 10
+        for (int i = 0; i < 40; ++i) {
+            const double speed = 10.0 + (i % 5) * 10.0;
+            const double edge_offset = -1.0 + (i / 5) * 2.0 / 7.0;
+            Eigen::VectorXd action(4);
+            action << speed, 1.0, edge_offset, 0.0;
+            const Eigen::Vector3d start(0.1 * i, -0.05 * i, 0.0);
+            const double distance = speed / 100.0;
+            const double dtheta = edge_offset / 10.0;
+            const Eigen::Vector3d end(
+                start.x() + distance * cos(dtheta),
+                start.y() + distance * sin(dtheta),
+                start.z() + dtheta);
+            m_dataset.add_sample(action, start, end);
+        }
+    }
+
+    std::shared_ptr<Kernel> m_kernel;
+    SparseGPRModel m_model;
+    Dataset m_dataset;
+};
+
+TEST_F(SparseGPRModelTest, TargetConversionTest) {
+    const Eigen::MatrixXd targets = GPModel::get_targets(
+        m_dataset.start_states(), m_dataset.end_states());
+    ASSERT_EQ(40, targets.rows());
+    EXPECT_NEAR(0.1, targets(0, 0), 1e-9);
+    EXPECT_NEAR(-0.1, targets(0, 1), 1e-9);
+
+    const Eigen::MatrixXd inputs = GPModel::get_inputs(m_dataset.actions());
+    EXPECT_NEAR(10.0, inputs(0, 0), 1e-9);
+    EXPECT_NEAR(-1.0, inputs(0, 1), 1e-9);
+    EXPECT_NEAR(1.0, inputs(0, 2), 1e-9);
+}
+
+TEST_F(SparseGPRModelTest, UntrainedModelTest) {
+    Eigen::VectorXd output_state;
+    EXPECT_FALSE(m_model.is_trained());
+    EXPECT_FALSE(m_model.predict_state(
+        Eigen::Vector4d(10, 1, 0, 0), Eigen::Vector3d(0, 0, 0),
+        &output_state));
+}
+
+TEST_F(SparseGPRModelTest, MatchesExactGPTest) {
+    // With every training input as an inducing point FITC is exact
+    const Eigen::MatrixXd inputs = GPModel::get_inputs(m_dataset.actions());
+    const Eigen::MatrixXd targets = GPModel::get_targets(
+        m_dataset.start_states(), m_dataset.end_states());
+    ASSERT_TRUE(m_model.train(inputs, targets, inputs));
+
+    Eigen::MatrixXd K;
+    m_kernel->compute(inputs, inputs, &K);
+    K.diagonal().array() += 1e-4;
+    const Eigen::LLT<Eigen::MatrixXd> llt(K);
+    const Eigen::MatrixXd alpha = llt.solve(targets);
+
+    Eigen::MatrixXd query(2, 4);
+    query << 25.0, 1.0, 0.1, 0.0,
+             42.0, 1.0, -0.6, 0.0;
+    const Eigen::MatrixXd query_inputs = GPModel::get_inputs(query);
+    Eigen::MatrixXd K_s;
+    m_kernel->compute(query_inputs, inputs, &K_s);
+    const Eigen::MatrixXd expected_means = K_s * alpha;
+    const Eigen::VectorXd expected_variances = (1.0 -
+        (K_s * llt.solve(K_s.transpose())).diagonal().array()).matrix();
+
+    Eigen::MatrixXd start_states = Eigen::MatrixXd::Zero(2, 3);
+    Eigen::MatrixXd output_states;
+    Eigen::MatrixXd output_variances;
+    ASSERT_TRUE(m_model.predict_distribution(
+        query, start_states, &output_states, &output_variances));
+    for (int i = 0; i < 2; ++i) {
+        const double distance = expected_means(i, 0);
+        const double dtheta = expected_means(i, 1);
+        EXPECT_NEAR(distance * cos(dtheta), output_states(i, 0), 1e-4);
+        EXPECT_NEAR(distance * sin(dtheta), output_states(i, 1), 1e-4);
+        EXPECT_NEAR(dtheta, output_states(i, 2), 1e-4);
+        EXPECT_NEAR(expected_variances[i], output_variances(i, 2), 1e-4);
+    }
+}
+
+TEST_F(SparseGPRModelTest, InducingPointPredictionTest) {
+    ASSERT_TRUE(m_model.train(m_dataset, 20));
+    EXPECT_TRUE(m_model.is_trained());
+    EXPECT_EQ(20, m_model.inducing_points().rows());
+
+    Eigen::VectorXd output_state;
+    ASSERT_TRUE(m_model.predict_state(
+        Eigen::Vector4d(30.0, 1.0, 0.0, 0.0),
+        Eigen::Vector3d(1.0, 2.0, 0.5),
+        &output_state));
+    EXPECT_NEAR(1.3, output_state[0], 0.02);
+    EXPECT_NEAR(2.0, output_state[1], 0.02);
+    EXPECT_NEAR(0.5, output_state[2], 0.02);
+
+    // Batched prediction matches single predictions
+    Eigen::MatrixXd actions(2, 4);
+    actions << 30.0, 1.0, 0.0, 0.0,
+               20.0, 1.0, 0.5, 0.0;
+    Eigen::MatrixXd states(2, 3);
+    states << 1.0, 2.0, 0.5,
+              0.0, 0.0, 0.0;
+    Eigen::MatrixXd output_states;
+    ASSERT_TRUE(m_model.predict_states(actions, states, &output_states));
+    for (int j = 0; j < 3; ++j) {
+        EXPECT_NEAR(output_state[j], output_states(0, j), 1e-12);
+    }
+}
+
+TEST_F(SparseGPRModelTest, DatasetFileTest) {
+    const std::string path = "test_sparse_gpr_dataset.csv";
+    std::ofstream file(path);
+    file << "# speed, aspect_ratio, edge_offset, heading_offset, ..." << std::endl
+         << "30, 1, 0, 0, 0, 0, 0, 0.3, 0, 0" << std::endl
+         << std::endl
+         << "20, 1, 0.5, 0, 1, 1, 0, 1.2, 1, 0.05" << std::endl;
+    file.close();
+
+    Dataset dataset(path);
+    EXPECT_EQ(2, dataset.size());
+    EXPECT_NEAR(20, dataset.actions()(1, 0), 1e-12);
+    EXPECT_NEAR(1, dataset.start_states()(1, 1), 1e-12);
+    EXPECT_NEAR(0.05, dataset.end_states()(1, 2), 1e-12);
+    std::remove(path.c_str());
+
+    EXPECT_THROW(Dataset("does_not_exist.csv"), std::invalid_argument);
+}
+
+TEST_F(SparseGPRModelTest, ThrowingExceptionTest) {
+    EXPECT_THROW(SparseGPRModel(nullptr, 1e-4), std::invalid_argument);
+    EXPECT_THROW(SparseGPRModel(m_kernel, -1.0), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
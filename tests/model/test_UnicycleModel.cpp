@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include "actionspace/GenericActionSpace.hpp"
+#include "model/UnicycleModel.hpp"
+
+namespace libcozmo {
+namespace model {
+namespace test {
+
+TEST(UnicycleModelTest, ModelPredictionTest) {
+    UnicycleModel model;
+    Eigen::VectorXd output_state;
+
+    // Drive straight ahead
+    ASSERT_TRUE(model.predict_state(
+        Eigen::Vector3d(2.0, 1.5, 0.0),
+        Eigen::Vector3d(1.0, 1.0, M_PI / 2),
+        &output_state));
+    EXPECT_NEAR(1.0, output_state[0], 1e-9);
+    EXPECT_NEAR(4.0, output_state[1], 1e-9);
+    EXPECT_NEAR(M_PI / 2, output_state[2], 1e-9);
+
+    // Turn then drive; orientation wraps to [0, 2pi)
+    ASSERT_TRUE(model.predict_state(
+        Eigen::Vector3d(1.0, 1.0, 3 * M_PI / 2),
+        Eigen::Vector3d(0.0, 0.0, M_PI),
+        &output_state));
+    EXPECT_NEAR(0.0, output_state[0], 1e-9);
+    EXPECT_NEAR(1.0, output_state[1], 1e-9);
+    EXPECT_NEAR(M_PI / 2, output_state[2], 1e-9);
+
+    EXPECT_FALSE(model.predict_state(
+        Eigen::Vector4d(1.0, 1.0, 0.0, 0.0),
+        Eigen::Vector3d(0.0, 0.0, 0.0),
+        &output_state));
+}
+
+TEST(UnicycleModelTest, BatchPredictionTest) {
+    UnicycleModel model;
+    actionspace::GenericActionSpace actionspace(
+        std::vector<double>{0.5, 1.0}, std::vector<double>{1.0, 2.0}, 8);
+
+    Eigen::MatrixXd actions(actionspace.size(), 3);
+    Eigen::MatrixXd states(actionspace.size(), 3);
+    for (int i = 0; i < actionspace.size(); ++i) {
+        actions.row(i) = actionspace.get_action(i)->vector().transpose();
+        states.row(i) << 0.1 * i, -0.2 * i, 0.3 * i;
+    }
+
+    Eigen::MatrixXd output_states;
+    ASSERT_TRUE(model.predict_states(actions, states, &output_states));
+    ASSERT_EQ(actionspace.size(), output_states.rows());
+    for (int i = 0; i < actionspace.size(); ++i) {
+        Eigen::VectorXd expected;
+        ASSERT_TRUE(model.predict_state(
+            actions.row(i).transpose(), states.row(i).transpose(),
+            &expected));
+        for (int j = 0; j < 3; ++j) {
+            EXPECT_NEAR(expected[j], output_states(i, j), 1e-9);
+        }
+    }
+
+    Eigen::MatrixXd output_variances;
+    ASSERT_TRUE(model.predict_distribution(
+        actions, states, &output_states, &output_variances));
+    EXPECT_TRUE(output_variances.isZero());
+}
+
+}  // namespace test
+}  // namespace model
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
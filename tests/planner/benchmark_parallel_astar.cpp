@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "actionspace/GenericActionSpace.hpp"
+#include "distance/SE2.hpp"
+#include "model/UnicycleModel.hpp"
+#include "planner/ParallelAStar.hpp"
+
+// Measures the expansion throughput of the parallel planner from 1 to N
+// threads. Each prediction burns a fixed amount of work to stand in for an
+// expensive learned model.
+// Usage: benchmark_parallel_astar [max_threads] [work_per_prediction]
+
+namespace {
+
+/// Unicycle model with an artificial cost per predicted state
+class SlowModel : public libcozmo::model::Model {
+ public:
+    explicit SlowModel(const int& work) : m_work(work) {}
+
+    bool predict_state(
+        const Eigen::VectorXd& input_action,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override {
+        burn();
+        return m_model.predict_state(input_action, input_state, output_state);
+    }
+
+ private:
+    void burn() const {
+        volatile double sink = 0;
+        for (int i = 0; i < m_work; ++i) {
+            sink = sink + std::sqrt(static_cast<double>(i));
+        }
+    }
+
+    const int m_work;
+    const libcozmo::model::UnicycleModel m_model;
+};
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    using namespace libcozmo;
+    const int max_threads = argc > 1 ? std::atoi(argv[1]) :
+        std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const int work = argc > 2 ? std::atoi(argv[2]) : 20000;
+
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-12, 15, 5);
+    std::printf("%8s %12s %12s %12s %10s %8s\n",
+        "threads", "expansions", "messages", "exp/s", "cost", "speedup");
+    double baseline = 0;
+    for (int num_threads = 1; num_threads <= max_threads; ++num_threads) {
+        // A fresh statespace per run, so every run registers the same
+        // states
+        const auto statespace = std::make_shared<statespace::SE2>(1.0, 8);
+        const auto actionspace =
+            std::make_shared<actionspace::GenericActionSpace>(
+                std::vector<double>{1.0},
+                std::vector<double>{1.0, 2.0},
+                8);
+        planner::ParallelAStar::Parameters parameters;
+        parameters.num_threads = num_threads;
+        planner::ParallelAStar planner(
+            statespace,
+            actionspace,
+            std::make_shared<SlowModel>(work),
+            std::make_shared<distance::SE2>(statespace),
+            parameters);
+        std::vector<int> actions;
+        if (!planner.solve(start, goal, &actions)) {
+            std::printf("%8d no path found\n", num_threads);
+            continue;
+        }
+        const auto& statistics = planner.get_statistics();
+        if (num_threads == 1) {
+            baseline = statistics.expansions_per_second;
+        }
+        std::printf("%8d %12d %12d %12.1f %10.3f %8.2f\n",
+            num_threads,
+            statistics.num_expansions,
+            statistics.num_messages,
+            statistics.expansions_per_second,
+            statistics.path_cost,
+            statistics.expansions_per_second / baseline);
+    }
+    return 0;
+}
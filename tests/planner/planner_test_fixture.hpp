@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef TESTS_PLANNER_PLANNER_TEST_FIXTURE_HPP_
+#define TESTS_PLANNER_PLANNER_TEST_FIXTURE_HPP_
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "actionspace/GenericActionSpace.hpp"
+#include "distance/SE2.hpp"
+#include "model/UnicycleModel.hpp"
+#include "planner/SE2Successors.hpp"
+#include "statespace/SE2.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+/// Planning problem shared by the planner tests: an SE2 grid with 8
+/// headings, unit-speed pushes of one or two seconds, the unicycle model and
+/// the SE2 distance as heuristic
+class PlannerTest : public ::testing::Test {
+ protected:
+    PlannerTest() :
+        statespace(std::make_shared<statespace::SE2>(1.0, 8)),
+        actionspace(std::make_shared<actionspace::GenericActionSpace>(
+            std::vector<double>{1.0},
+            std::vector<double>{1.0, 2.0},
+            8)),
+        model(std::make_shared<model::UnicycleModel>()),
+        distance(std::make_shared<distance::SE2>(statespace)) {}
+
+    /// Checks that the actions lead from the start to the goal through the
+    /// returned states
+    void check_path(
+        const statespace::SE2::State& start,
+        const statespace::SE2::State& goal,
+        const std::vector<int>& actions,
+        const std::vector<int>& states) {
+        ASSERT_EQ(actions.size() + 1, states.size());
+        int start_id, goal_id;
+        ASSERT_TRUE(statespace->get_state_id(start, &start_id));
+        ASSERT_TRUE(statespace->get_state_id(goal, &goal_id));
+        EXPECT_EQ(start_id, states.front());
+        EXPECT_EQ(goal_id, states.back());
+        const SE2Successors successors(statespace, actionspace, model);
+        for (int i = 0; i < static_cast<int>(actions.size()); ++i) {
+            int successor_id;
+            ASSERT_TRUE(successors.get_successor(
+                states[i], actions[i], &successor_id));
+            EXPECT_EQ(states[i + 1], successor_id);
+        }
+    }
+
+    std::shared_ptr<statespace::SE2> statespace;
+    std::shared_ptr<actionspace::GenericActionSpace> actionspace;
+    std::shared_ptr<model::UnicycleModel> model;
+    std::shared_ptr<distance::SE2> distance;
+};
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+#endif  // TESTS_PLANNER_PLANNER_TEST_FIXTURE_HPP_
@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "planner/ARAStar.hpp"
+#include "planner/WeightedAStar.hpp"
+#include "planner_test_fixture.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+class ARAStarTest : public PlannerTest {
+ protected:
+    ARAStarTest() : start(0, 0, 0), goal(-6, 5, 3) {}
+
+    /// Gets the optimal path cost
+    double optimal_cost() {
+        WeightedAStar planner(statespace, actionspace, model, distance);
+        std::vector<int> actions;
+        EXPECT_TRUE(planner.solve(start, goal, &actions));
+        return planner.get_statistics().path_cost;
+    }
+
+    const statespace::SE2::State start;
+    const statespace::SE2::State goal;
+};
+
+TEST_F(ARAStarTest, ConvergesToOptimal) {
+    ARAStar planner(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, goal, 0.0, &actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_TRUE(planner.is_finished());
+
+    const auto& statistics = planner.get_statistics();
+    // Epsilon 3, 2.5, 2, 1.5, 1
+    EXPECT_EQ(5, statistics.num_searches);
+    EXPECT_DOUBLE_EQ(1.0, statistics.epsilon);
+    EXPECT_DOUBLE_EQ(1.0, statistics.suboptimality_bound);
+    ASSERT_EQ(5, statistics.solution_costs.size());
+    for (int i = 1; i < static_cast<int>(statistics.solution_costs.size());
+         ++i) {
+        EXPECT_LE(
+            statistics.solution_costs[i], statistics.solution_costs[i - 1]);
+    }
+    EXPECT_NEAR(optimal_cost(), statistics.path_cost, 1e-9);
+}
+
+TEST_F(ARAStarTest, BoundHoldsForEachEpsilon) {
+    const double optimal = optimal_cost();
+    ARAStar::Parameters parameters;
+    parameters.initial_epsilon = 5.0;
+    parameters.epsilon_step = 1.0;
+    ARAStar planner(statespace, actionspace, model, distance, parameters);
+
+    // Plan in short time slices, checking the bound after each one
+    std::vector<int> actions;
+    std::vector<int> states;
+    bool found = planner.solve(start, goal, 1e-4, &actions, &states);
+    for (int i = 0; i < 100000 && !planner.is_finished(); ++i) {
+        const auto& statistics = planner.get_statistics();
+        if (found && statistics.num_searches > 0) {
+            check_path(start, goal, actions, states);
+            EXPECT_LE(statistics.suboptimality_bound, statistics.epsilon);
+            EXPECT_LE(
+                statistics.path_cost,
+                statistics.suboptimality_bound * optimal + 1e-9);
+        }
+        found = planner.improve(1e-4, &actions, &states);
+    }
+    ASSERT_TRUE(planner.is_finished());
+    ASSERT_TRUE(found);
+    check_path(start, goal, actions, states);
+    EXPECT_NEAR(optimal, planner.get_statistics().path_cost, 1e-9);
+}
+
+TEST_F(ARAStarTest, ReusesSearchTree) {
+    // Improving a solution expands fewer states than solving again from
+    // scratch with each epsilon
+    ARAStar::Parameters parameters;
+    parameters.initial_epsilon = 2.0;
+    parameters.epsilon_step = 1.0;
+    ARAStar planner(statespace, actionspace, model, distance, parameters);
+    std::vector<int> actions;
+    ASSERT_TRUE(planner.solve(start, goal, 0.0, &actions));
+    ASSERT_EQ(2, planner.get_statistics().num_searches);
+
+    int scratch_expansions = 0;
+    for (const double& weight : {2.0, 1.0}) {
+        WeightedAStar::Parameters weighted_parameters;
+        weighted_parameters.weight = weight;
+        WeightedAStar weighted(
+            statespace, actionspace, model, distance, weighted_parameters);
+        ASSERT_TRUE(weighted.solve(start, goal, &actions));
+        scratch_expansions += weighted.get_statistics().num_expansions;
+    }
+    EXPECT_LT(planner.get_statistics().num_expansions, scratch_expansions);
+}
+
+TEST_F(ARAStarTest, StartIsGoal) {
+    ARAStar planner(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(goal, goal, 0.0, &actions, &states));
+    EXPECT_TRUE(actions.empty());
+    EXPECT_EQ(1, states.size());
+    EXPECT_DOUBLE_EQ(0.0, planner.get_statistics().path_cost);
+}
+
+TEST_F(ARAStarTest, InvalidArguments) {
+    ARAStar::Parameters parameters;
+    parameters.final_epsilon = 0.5;
+    EXPECT_THROW(
+        ARAStar(statespace, actionspace, model, distance, parameters),
+        std::invalid_argument);
+    parameters = ARAStar::Parameters();
+    parameters.epsilon_step = 0.0;
+    EXPECT_THROW(
+        ARAStar(statespace, actionspace, model, distance, parameters),
+        std::invalid_argument);
+    EXPECT_THROW(
+        ARAStar(statespace, actionspace, model, nullptr),
+        std::invalid_argument);
+
+    ARAStar planner(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    EXPECT_FALSE(planner.improve(0.0, &actions));
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
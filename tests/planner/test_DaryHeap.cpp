@@ -0,0 +1,113 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "planner/DaryHeap.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+/// Checks that ids are popped in key order after random updates
+template <int Arity>
+void check_random_updates() {
+    std::mt19937 generator(Arity);
+    std::uniform_real_distribution<double> uniform(0.0, 100.0);
+    DaryHeap<double, Arity> heap;
+    std::vector<double> keys(200, -1.0);
+    for (int i = 0; i < 2000; ++i) {
+        const int id = generator() % keys.size();
+        if (generator() % 5 == 0) {
+            heap.erase(id);
+            keys[id] = -1.0;
+        } else {
+            keys[id] = uniform(generator);
+            heap.push(id, keys[id]);
+        }
+    }
+    const int size = std::count_if(
+        keys.begin(), keys.end(), [](const double& key) { return key >= 0; });
+    ASSERT_EQ(size, heap.size());
+    for (int id = 0; id < static_cast<int>(keys.size()); ++id) {
+        ASSERT_EQ(keys[id] >= 0, heap.contains(id));
+        if (keys[id] >= 0) {
+            EXPECT_EQ(keys[id], heap.key(id));
+        }
+    }
+    double previous = -1.0;
+    while (!heap.empty()) {
+        const double key = heap.top_key();
+        const int id = heap.pop();
+        EXPECT_EQ(keys[id], key);
+        EXPECT_LE(previous, key);
+        EXPECT_FALSE(heap.contains(id));
+        previous = key;
+    }
+}
+
+TEST(DaryHeapTest, RandomUpdatesBinary) {
+    check_random_updates<2>();
+}
+
+TEST(DaryHeapTest, RandomUpdatesQuaternary) {
+    check_random_updates<4>();
+}
+
+TEST(DaryHeapTest, RandomUpdatesOctonary) {
+    check_random_updates<8>();
+}
+
+TEST(DaryHeapTest, DecreaseAndIncreaseKey) {
+    DaryHeap<double> heap;
+    heap.push(3, 5.0);
+    heap.push(7, 2.0);
+    heap.push(1, 4.0);
+    EXPECT_EQ(7, heap.top());
+    heap.push(3, 1.0);
+    EXPECT_EQ(3, heap.top());
+    heap.push(3, 9.0);
+    EXPECT_EQ(7, heap.top());
+    EXPECT_FALSE(heap.contains(2));
+    EXPECT_FALSE(heap.contains(100));
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(3));
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "planner/LPAStar.hpp"
+#include "planner/WeightedAStar.hpp"
+#include "planner_test_fixture.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+class LPAStarTest : public PlannerTest {
+ protected:
+    LPAStarTest() : start(0, 0, 0), goal(6, 3, 2) {}
+
+    const statespace::SE2::State start;
+    const statespace::SE2::State goal;
+};
+
+TEST_F(LPAStarTest, FindsOptimalPath) {
+    WeightedAStar reference(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(reference.solve(start, goal, &actions));
+
+    LPAStar planner(statespace, actionspace, model, distance);
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_NEAR(
+        reference.get_statistics().path_cost,
+        planner.get_statistics().path_cost,
+        1e-9);
+    EXPECT_GT(planner.get_statistics().num_expansions, 0);
+}
+
+TEST_F(LPAStarTest, RepairsAfterEdgeCostChange) {
+    LPAStar planner(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    const double cost = planner.get_statistics().path_cost;
+    const int initial_expansions = planner.get_statistics().num_expansions;
+
+    // Block the middle edge of the path
+    const int blocked_state = states[states.size() / 2];
+    const int blocked_action = actions[actions.size() / 2];
+    planner.set_edge_cost(
+        blocked_state, blocked_action, std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(planner.replan(&actions, &states));
+    check_path(start, goal, actions, states);
+    const double blocked_cost = planner.get_statistics().path_cost;
+    EXPECT_GE(blocked_cost, cost - 1e-9);
+    EXPECT_LT(planner.get_statistics().num_expansions, initial_expansions);
+    EXPECT_EQ(0, planner.get_statistics().num_model_calls);
+    for (int i = 0; i < static_cast<int>(actions.size()); ++i) {
+        EXPECT_FALSE(
+            states[i] == blocked_state && actions[i] == blocked_action);
+    }
+
+    // Same cost as a search from scratch that knows the blocked edge
+    LPAStar fresh(statespace, actionspace, model, distance);
+    fresh.set_edge_cost(
+        blocked_state, blocked_action, std::numeric_limits<double>::infinity());
+    ASSERT_TRUE(fresh.solve(start, goal, &actions));
+    EXPECT_NEAR(blocked_cost, fresh.get_statistics().path_cost, 1e-9);
+
+    // Restoring the edge restores the cost
+    planner.set_edge_cost(blocked_state, blocked_action, -1.0);
+    ASSERT_TRUE(planner.replan(&actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_NEAR(cost, planner.get_statistics().path_cost, 1e-9);
+}
+
+TEST_F(LPAStarTest, RepairsAfterValidityChange) {
+    LPAStar planner(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    const double cost = planner.get_statistics().path_cost;
+
+    // Invalidate every state of the path but its ends
+    std::vector<int> blocked(states.begin() + 1, states.end() - 1);
+    ASSERT_FALSE(blocked.empty());
+    for (const int& state_id : blocked) {
+        planner.set_state_validity(state_id, false);
+    }
+    ASSERT_TRUE(planner.replan(&actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_GE(planner.get_statistics().path_cost, cost - 1e-9);
+    for (const int& state_id : states) {
+        EXPECT_EQ(blocked.end(),
+            std::find(blocked.begin(), blocked.end(), state_id));
+    }
+
+    for (const int& state_id : blocked) {
+        planner.set_state_validity(state_id, true);
+    }
+    ASSERT_TRUE(planner.replan(&actions, &states));
+    EXPECT_NEAR(cost, planner.get_statistics().path_cost, 1e-9);
+}
+
+TEST_F(LPAStarTest, MovesGoal) {
+    LPAStar planner(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+
+    const statespace::SE2::State moved_goal(6, 4, 2);
+    planner.set_goal(moved_goal);
+    ASSERT_TRUE(planner.replan(&actions, &states));
+    check_path(start, moved_goal, actions, states);
+
+    LPAStar fresh(statespace, actionspace, model, distance);
+    ASSERT_TRUE(fresh.solve(start, moved_goal, &actions));
+    EXPECT_NEAR(
+        fresh.get_statistics().path_cost,
+        planner.get_statistics().path_cost,
+        1e-9);
+    EXPECT_LT(
+        planner.get_statistics().num_model_calls,
+        fresh.get_statistics().num_model_calls);
+}
+
+TEST_F(LPAStarTest, ReplanBeforeSolve) {
+    LPAStar planner(statespace, actionspace, model, distance);
+    std::vector<int> actions{0};
+    EXPECT_FALSE(planner.replan(&actions));
+    EXPECT_TRUE(actions.empty());
+}
+
+TEST_F(LPAStarTest, InvalidArguments) {
+    EXPECT_THROW(
+        LPAStar(statespace, actionspace, model, nullptr),
+        std::invalid_argument);
+    EXPECT_THROW(
+        LPAStar(statespace, actionspace, nullptr, distance),
+        std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,201 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "planner/LazyWeightedAStar.hpp"
+#include "planner/WeightedAStar.hpp"
+#include "planner_test_fixture.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+/// Estimates every successor as the state itself, which is optimistic for
+/// a consistent heuristic
+class StationaryModel : public model::Model {
+ public:
+    bool predict_state(
+        const Eigen::VectorXd&,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override {
+        *output_state = input_state;
+        return true;
+    }
+};
+
+/// Unicycle that only covers half the distance of each action, so its
+/// estimates fall short of the true successors
+class SlowUnicycleModel : public model::Model {
+ public:
+    bool predict_state(
+        const Eigen::VectorXd& input_action,
+        const Eigen::VectorXd& input_state,
+        Eigen::VectorXd* output_state) const override {
+        Eigen::VectorXd action = input_action;
+        action[0] *= 0.5;
+        return m_unicycle.predict_state(action, input_state, output_state);
+    }
+
+ private:
+    const model::UnicycleModel m_unicycle;
+};
+
+class LazyWeightedAStarTest : public PlannerTest {};
+
+TEST_F(LazyWeightedAStarTest, ExactEstimatesMatchEagerSearch) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-3, 4, 2);
+    WeightedAStar eager(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(eager.solve(start, goal, &actions, &states));
+
+    // Pruning by the estimates is sound since they are the true successors
+    LazyWeightedAStar::Parameters parameters;
+    parameters.prune_estimates = true;
+    LazyWeightedAStar lazy(
+        statespace, actionspace, model, model, distance, parameters);
+    ASSERT_TRUE(lazy.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    const auto& statistics = lazy.get_statistics();
+    EXPECT_NEAR(eager.get_statistics().path_cost, statistics.path_cost, 1e-9);
+    EXPECT_EQ(
+        statistics.num_expansions * actionspace->size(),
+        statistics.num_estimates);
+    EXPECT_GT(statistics.num_pruned, 0);
+}
+
+TEST_F(LazyWeightedAStarTest, CheapEstimatesDeferEvaluations) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-3, 4, 2);
+    WeightedAStar eager(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(eager.solve(start, goal, &actions, &states));
+
+    LazyWeightedAStar lazy(
+        statespace,
+        actionspace,
+        model,
+        std::make_shared<SlowUnicycleModel>(),
+        distance);
+    ASSERT_TRUE(lazy.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    const auto& statistics = lazy.get_statistics();
+    EXPECT_NEAR(eager.get_statistics().path_cost, statistics.path_cost, 1e-9);
+    EXPECT_EQ(0, statistics.num_pruned);
+    // The eager search predicts every action of every expanded state
+    EXPECT_LT(
+        4 * statistics.num_evaluations,
+        eager.get_statistics().num_generated);
+}
+
+TEST_F(LazyWeightedAStarTest, OptimisticEstimatesKeepCost) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(5, -2, 6);
+    WeightedAStar eager(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(eager.solve(start, goal, &actions, &states));
+
+    LazyWeightedAStar lazy(
+        statespace,
+        actionspace,
+        model,
+        std::make_shared<StationaryModel>(),
+        distance);
+    ASSERT_TRUE(lazy.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_NEAR(
+        eager.get_statistics().path_cost,
+        lazy.get_statistics().path_cost,
+        1e-9);
+}
+
+TEST_F(LazyWeightedAStarTest, WeightBoundsCost) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-3, 4, 2);
+    WeightedAStar eager(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(eager.solve(start, goal, &actions, &states));
+    const double optimal_cost = eager.get_statistics().path_cost;
+
+    LazyWeightedAStar::Parameters parameters;
+    parameters.weight = 3.0;
+    LazyWeightedAStar lazy(
+        statespace, actionspace, model, model, distance, parameters);
+    ASSERT_TRUE(lazy.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_GE(lazy.get_statistics().path_cost, optimal_cost - 1e-9);
+    EXPECT_LE(
+        lazy.get_statistics().path_cost,
+        parameters.weight * optimal_cost + 1e-9);
+}
+
+TEST_F(LazyWeightedAStarTest, ExpansionLimit) {
+    LazyWeightedAStar::Parameters parameters;
+    parameters.max_expansions = 3;
+    LazyWeightedAStar planner(
+        statespace, actionspace, model, model, distance, parameters);
+    std::vector<int> actions;
+    EXPECT_FALSE(planner.solve(
+        statespace::SE2::State(0, 0, 0),
+        statespace::SE2::State(20, 20, 4),
+        &actions));
+    EXPECT_TRUE(actions.empty());
+    EXPECT_EQ(3, planner.get_statistics().num_expansions);
+}
+
+TEST_F(LazyWeightedAStarTest, InvalidArguments) {
+    EXPECT_THROW(
+        LazyWeightedAStar(statespace, actionspace, model, model, nullptr),
+        std::invalid_argument);
+    EXPECT_THROW(
+        LazyWeightedAStar(statespace, actionspace, model, nullptr, distance),
+        std::invalid_argument);
+    LazyWeightedAStar::Parameters parameters;
+    parameters.weight = 0.5;
+    EXPECT_THROW(
+        LazyWeightedAStar(
+            statespace, actionspace, model, model, distance, parameters),
+        std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
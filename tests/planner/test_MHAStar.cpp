@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+#include "distance/weighted_se2.hpp"
+#include "planner/MHAStar.hpp"
+#include "planner/WeightedAStar.hpp"
+#include "planner_test_fixture.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+class MHAStarTest : public PlannerTest {
+ protected:
+    MHAStarTest() :
+        heuristics{
+            std::make_shared<distance::WeightedSE2>(statespace, 1.0, 0.0),
+            std::make_shared<distance::WeightedSE2>(statespace, 0.2, 3.0)} {}
+
+    /// Approach and alignment heuristics
+    std::vector<std::shared_ptr<distance::Distance>> heuristics;
+};
+
+TEST_F(MHAStarTest, BoundsCostWithFewerExpansions) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-20, -20, 2);
+    WeightedAStar optimal(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(optimal.solve(start, goal, &actions));
+    const double optimal_cost = optimal.get_statistics().path_cost;
+
+    MHAStar planner(statespace, actionspace, model, distance, heuristics);
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    const auto& statistics = planner.get_statistics();
+    const auto& parameters = planner.get_parameters();
+    EXPECT_GE(statistics.path_cost, optimal_cost - 1e-9);
+    EXPECT_LE(
+        statistics.path_cost,
+        parameters.heuristic_weight * parameters.anchor_weight *
+            optimal_cost + 1e-9);
+    EXPECT_LT(
+        statistics.num_expansions,
+        optimal.get_statistics().num_expansions / 4);
+
+    ASSERT_EQ(heuristics.size() + 1, statistics.queue_expansions.size());
+    int num_expansions = 0;
+    for (const int& expansions : statistics.queue_expansions) {
+        num_expansions += expansions;
+    }
+    EXPECT_EQ(statistics.num_expansions, num_expansions);
+    // Round robin shares the expansions between the inadmissible lists
+    EXPECT_LE(
+        std::abs(statistics.queue_expansions[1] -
+            statistics.queue_expansions[2]),
+        statistics.queue_expansions[0] + 1);
+}
+
+TEST_F(MHAStarTest, UnitWeightsAreOptimal) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-3, 4, 2);
+    WeightedAStar optimal(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(optimal.solve(start, goal, &actions));
+
+    MHAStar::Parameters parameters;
+    parameters.heuristic_weight = 1.0;
+    parameters.anchor_weight = 1.0;
+    MHAStar planner(
+        statespace, actionspace, model, distance, heuristics, parameters);
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_NEAR(
+        optimal.get_statistics().path_cost,
+        planner.get_statistics().path_cost,
+        1e-9);
+}
+
+TEST_F(MHAStarTest, StartIsGoal) {
+    MHAStar planner(statespace, actionspace, model, distance, heuristics);
+    const statespace::SE2::State start(2, 2, 1);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, start, &actions, &states));
+    EXPECT_TRUE(actions.empty());
+    ASSERT_EQ(1, states.size());
+    EXPECT_EQ(0, planner.get_statistics().num_expansions);
+}
+
+TEST_F(MHAStarTest, ExpansionLimit) {
+    MHAStar::Parameters parameters;
+    parameters.max_expansions = 3;
+    MHAStar planner(
+        statespace, actionspace, model, distance, heuristics, parameters);
+    std::vector<int> actions;
+    EXPECT_FALSE(planner.solve(
+        statespace::SE2::State(0, 0, 0),
+        statespace::SE2::State(20, 20, 4),
+        &actions));
+    EXPECT_TRUE(actions.empty());
+    EXPECT_EQ(3, planner.get_statistics().num_expansions);
+}
+
+TEST_F(MHAStarTest, InvalidArguments) {
+    EXPECT_THROW(
+        MHAStar(statespace, actionspace, model, nullptr, heuristics),
+        std::invalid_argument);
+    EXPECT_THROW(
+        MHAStar(statespace, actionspace, model, distance, {}),
+        std::invalid_argument);
+    EXPECT_THROW(
+        MHAStar(statespace, actionspace, model, distance, {nullptr}),
+        std::invalid_argument);
+    MHAStar::Parameters parameters;
+    parameters.anchor_weight = 0.5;
+    EXPECT_THROW(
+        MHAStar(
+            statespace, actionspace, model, distance, heuristics, parameters),
+        std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
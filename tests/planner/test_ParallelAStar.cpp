@@ -0,0 +1,162 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "planner/ParallelAStar.hpp"
+#include "planner/WeightedAStar.hpp"
+#include "planner_test_fixture.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+class ParallelAStarTest : public PlannerTest {
+ protected:
+    /// Gets the cost of the path through the given states
+    double path_cost(const std::vector<int>& states) {
+        double cost = 0;
+        for (int i = 1; i < static_cast<int>(states.size()); ++i) {
+            cost += distance->get_distance(
+                *statespace->get_state(states[i - 1]),
+                *statespace->get_state(states[i]));
+        }
+        return cost;
+    }
+};
+
+TEST_F(ParallelAStarTest, MatchesSequentialCost) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-3, 4, 2);
+    WeightedAStar sequential(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(sequential.solve(start, goal, &actions, &states));
+    const double optimal_cost = sequential.get_statistics().path_cost;
+
+    for (const int num_threads : {1, 2, 4}) {
+        ParallelAStar::Parameters parameters;
+        parameters.num_threads = num_threads;
+        ParallelAStar planner(
+            statespace, actionspace, model, distance, parameters);
+        EXPECT_EQ(num_threads, planner.num_threads());
+        ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+        check_path(start, goal, actions, states);
+        const auto& statistics = planner.get_statistics();
+        EXPECT_NEAR(optimal_cost, statistics.path_cost, 1e-9);
+        EXPECT_NEAR(statistics.path_cost, path_cost(states), 1e-9);
+        ASSERT_EQ(num_threads, statistics.thread_expansions.size());
+        int num_expansions = 0;
+        for (const int expansions : statistics.thread_expansions) {
+            num_expansions += expansions;
+        }
+        EXPECT_EQ(statistics.num_expansions, num_expansions);
+        EXPECT_GT(statistics.num_expansions, 0);
+        if (num_threads == 1) {
+            EXPECT_EQ(0, statistics.num_messages);
+        }
+    }
+}
+
+TEST_F(ParallelAStarTest, WeightBoundsCost) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(5, -2, 6);
+    WeightedAStar sequential(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(sequential.solve(start, goal, &actions, &states));
+    const double optimal_cost = sequential.get_statistics().path_cost;
+
+    ParallelAStar::Parameters parameters;
+    parameters.weight = 3.0;
+    parameters.num_threads = 3;
+    ParallelAStar planner(
+        statespace, actionspace, model, distance, parameters);
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_GE(planner.get_statistics().path_cost, optimal_cost - 1e-9);
+    EXPECT_LE(
+        planner.get_statistics().path_cost,
+        parameters.weight * optimal_cost + 1e-9);
+}
+
+TEST_F(ParallelAStarTest, StartIsGoal) {
+    ParallelAStar::Parameters parameters;
+    parameters.num_threads = 2;
+    ParallelAStar planner(
+        statespace, actionspace, model, distance, parameters);
+    const statespace::SE2::State start(2, 2, 1);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, start, &actions, &states));
+    EXPECT_TRUE(actions.empty());
+    ASSERT_EQ(1, states.size());
+    EXPECT_EQ(0, planner.get_statistics().path_cost);
+}
+
+TEST_F(ParallelAStarTest, GoalTolerance) {
+    ParallelAStar::Parameters parameters;
+    parameters.goal_tolerance = 1.5;
+    parameters.num_threads = 2;
+    ParallelAStar planner(
+        statespace, actionspace, model, distance, parameters);
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(5, 0, 0);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    EXPECT_LE(
+        distance->get_distance(*statespace->get_state(states.back()), goal),
+        1.5);
+}
+
+TEST_F(ParallelAStarTest, InvalidArguments) {
+    EXPECT_THROW(
+        ParallelAStar(statespace, actionspace, model, nullptr),
+        std::invalid_argument);
+    EXPECT_THROW(
+        ParallelAStar(statespace, actionspace, nullptr, distance),
+        std::invalid_argument);
+    ParallelAStar::Parameters parameters;
+    parameters.weight = 0.5;
+    EXPECT_THROW(
+        ParallelAStar(statespace, actionspace, model, distance, parameters),
+        std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
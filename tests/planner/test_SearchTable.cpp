@@ -0,0 +1,145 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "planner/SearchTable.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+TEST(SearchTableTest, UnvisitedDefaults) {
+    SearchTable table;
+    EXPECT_EQ(0, table.size());
+    EXPECT_FALSE(table.visited(3));
+    EXPECT_TRUE(std::isinf(table.g(3)));
+    EXPECT_GT(0, table.h(3));
+    EXPECT_EQ(-1, table.parent(3));
+    EXPECT_EQ(-1, table.action(3));
+    EXPECT_FALSE(table.closed(3));
+}
+
+TEST(SearchTableTest, WritesAndGrows) {
+    SearchTable table;
+    table.set_g(10, 2.5);
+    EXPECT_GE(table.size(), 11);
+    EXPECT_TRUE(table.visited(10));
+    EXPECT_FALSE(table.visited(9));
+    EXPECT_EQ(2.5, table.g(10));
+    // The other fields of a visited state keep their defaults
+    EXPECT_GT(0, table.h(10));
+    EXPECT_EQ(-1, table.parent(10));
+    EXPECT_FALSE(table.closed(10));
+
+    table.set_h(10, 1.0);
+    table.set_parent(10, 4, 7);
+    table.set_closed(10);
+    EXPECT_EQ(1.0, table.h(10));
+    EXPECT_EQ(4, table.parent(10));
+    EXPECT_EQ(7, table.action(10));
+    EXPECT_TRUE(table.closed(10));
+
+    table.set_g(1000, 1.0);
+    EXPECT_GE(table.size(), 1001);
+    EXPECT_EQ(2.5, table.g(10));
+
+    table.reserve(5000);
+    EXPECT_EQ(5000, table.size());
+    EXPECT_EQ(1.0, table.g(1000));
+}
+
+TEST(SearchTableTest, ResetForgetsQuery) {
+    SearchTable table;
+    table.set_g(5, 1.0);
+    table.set_h(5, 2.0);
+    table.set_parent(5, 1, 2);
+    table.set_closed(5);
+    table.reset();
+    EXPECT_FALSE(table.visited(5));
+    EXPECT_TRUE(std::isinf(table.g(5)));
+    EXPECT_FALSE(table.closed(5));
+
+    // Writing one field of a stale entry resets the others
+    table.set_h(5, 3.0);
+    EXPECT_EQ(3.0, table.h(5));
+    EXPECT_TRUE(std::isinf(table.g(5)));
+    EXPECT_EQ(-1, table.parent(5));
+    EXPECT_EQ(-1, table.action(5));
+    EXPECT_FALSE(table.closed(5));
+}
+
+TEST(SearchTableTest, ResetClosedKeepsData) {
+    SearchTable table;
+    table.set_g(2, 1.0);
+    table.set_closed(2);
+    table.set_closed(3);
+    table.reset_closed();
+    EXPECT_FALSE(table.closed(2));
+    EXPECT_FALSE(table.closed(3));
+    EXPECT_EQ(1.0, table.g(2));
+    EXPECT_TRUE(table.visited(3));
+    table.set_closed(2);
+    EXPECT_TRUE(table.closed(2));
+    EXPECT_FALSE(table.closed(3));
+}
+
+TEST(SearchTableTest, ExtractPath) {
+    SearchTable table;
+    table.set_parent(4, -1, -1);
+    table.set_parent(7, 4, 2);
+    table.set_parent(1, 7, 0);
+    table.set_parent(9, 4, 5);
+
+    // Stale output is replaced
+    std::vector<int> actions = {3, 3};
+    std::vector<int> states;
+    table.extract_path(1, &actions, &states);
+    EXPECT_EQ(std::vector<int>({2, 0}), actions);
+    EXPECT_EQ(std::vector<int>({4, 7, 1}), states);
+
+    table.extract_path(9, &actions, nullptr);
+    EXPECT_EQ(std::vector<int>({5}), actions);
+
+    // The path to the start is empty
+    table.extract_path(4, &actions, &states);
+    EXPECT_TRUE(actions.empty());
+    EXPECT_EQ(std::vector<int>({4}), states);
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,133 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include "planner/WeightedAStar.hpp"
+#include "planner_test_fixture.hpp"
+
+namespace libcozmo {
+namespace planner {
+namespace test {
+
+class WeightedAStarTest : public PlannerTest {};
+
+TEST_F(WeightedAStarTest, FindsOptimalStraightPath) {
+    WeightedAStar planner(statespace, actionspace, model, distance);
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(3, 0, 0);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    // One short and one long step forward
+    EXPECT_EQ(2, actions.size());
+    EXPECT_NEAR(3.0, planner.get_statistics().path_cost, 1e-9);
+    EXPECT_GT(planner.get_statistics().num_expansions, 0);
+    EXPECT_GE(
+        planner.get_statistics().num_generated,
+        planner.get_statistics().num_expansions);
+}
+
+TEST_F(WeightedAStarTest, WeightBoundsCost) {
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(-3, 4, 2);
+
+    WeightedAStar optimal(statespace, actionspace, model, distance);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(optimal.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+
+    WeightedAStar::Parameters parameters;
+    parameters.weight = 3.0;
+    WeightedAStar weighted(
+        statespace, actionspace, model, distance, parameters);
+    ASSERT_TRUE(weighted.solve(start, goal, &actions, &states));
+    check_path(start, goal, actions, states);
+    EXPECT_GE(
+        weighted.get_statistics().path_cost,
+        optimal.get_statistics().path_cost - 1e-9);
+    EXPECT_LE(
+        weighted.get_statistics().path_cost,
+        parameters.weight * optimal.get_statistics().path_cost + 1e-9);
+}
+
+TEST_F(WeightedAStarTest, GoalTolerance) {
+    WeightedAStar::Parameters parameters;
+    parameters.goal_tolerance = 1.5;
+    WeightedAStar planner(
+        statespace, actionspace, model, distance, parameters);
+    const statespace::SE2::State start(0, 0, 0);
+    const statespace::SE2::State goal(5, 0, 0);
+    std::vector<int> actions;
+    std::vector<int> states;
+    ASSERT_TRUE(planner.solve(start, goal, &actions, &states));
+    EXPECT_LE(
+        distance->get_distance(*statespace->get_state(states.back()), goal),
+        1.5);
+}
+
+TEST_F(WeightedAStarTest, ExpansionLimit) {
+    WeightedAStar::Parameters parameters;
+    parameters.max_expansions = 3;
+    WeightedAStar planner(
+        statespace, actionspace, model, distance, parameters);
+    std::vector<int> actions;
+    EXPECT_FALSE(planner.solve(
+        statespace::SE2::State(0, 0, 0),
+        statespace::SE2::State(20, 20, 4),
+        &actions));
+    EXPECT_TRUE(actions.empty());
+    EXPECT_EQ(3, planner.get_statistics().num_expansions);
+}
+
+TEST_F(WeightedAStarTest, InvalidArguments) {
+    EXPECT_THROW(
+        WeightedAStar(statespace, actionspace, model, nullptr),
+        std::invalid_argument);
+    EXPECT_THROW(
+        WeightedAStar(statespace, actionspace, nullptr, distance),
+        std::invalid_argument);
+    WeightedAStar::Parameters parameters;
+    parameters.weight = 0.5;
+    EXPECT_THROW(
+        WeightedAStar(statespace, actionspace, model, distance, parameters),
+        std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace planner
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
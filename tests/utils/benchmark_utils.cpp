@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "utils/utils.hpp"
+
+// Compares the scalar and batch geometry utilities on the same inputs.
+// Usage: benchmark_utils [num_points] [num_repetitions]
+
+namespace {
+
+template <typename Function>
+double time_seconds(const int& repetitions, Function function) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < repetitions; ++i) {
+        function();
+    }
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / repetitions;
+}
+
+void report(const char* name, const int& num_points, const double& seconds) {
+    std::printf("%-32s %10.3f us %10.2f Mpts/s\n",
+        name, seconds * 1e6, num_points / seconds * 1e-6);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    using namespace libcozmo;
+    const int num_points = argc > 1 ? std::atoi(argv[1]) : 1 << 16;
+    const int repetitions = argc > 2 ? std::atoi(argv[2]) : 100;
+
+    Eigen::ArrayXXd a = Eigen::ArrayXXd::Random(num_points, 3) * 100.0;
+    Eigen::ArrayXXd b = Eigen::ArrayXXd::Random(num_points, 3) * 100.0;
+    Eigen::ArrayXd angles = Eigen::ArrayXd::Random(num_points) * 20.0;
+    Eigen::ArrayXd output(num_points);
+    // Accumulated so the compiler cannot drop the work
+    double checksum = 0;
+
+    std::vector<Eigen::Vector3d> points_a(num_points);
+    std::vector<Eigen::Vector3d> points_b(num_points);
+    std::vector<std::vector<double>> generic_a(num_points);
+    std::vector<std::vector<double>> generic_b(num_points);
+    for (int i = 0; i < num_points; ++i) {
+        points_a[i] = a.row(i).transpose().matrix();
+        points_b[i] = b.row(i).transpose().matrix();
+        generic_a[i] = {a(i, 0), a(i, 1), a(i, 2)};
+        generic_b[i] = {b(i, 0), b(i, 1), b(i, 2)};
+    }
+
+    report("euclidean_distance generic", num_points,
+        time_seconds(repetitions, [&]() {
+            for (int i = 0; i < num_points; ++i) {
+                output(i) =
+                    utils::euclidean_distance(generic_a[i], generic_b[i]);
+            }
+            checksum += output.sum();
+        }));
+    report("euclidean_distance Vector3d", num_points,
+        time_seconds(repetitions, [&]() {
+            for (int i = 0; i < num_points; ++i) {
+                output(i) =
+                    utils::euclidean_distance(points_a[i], points_b[i]);
+            }
+            checksum += output.sum();
+        }));
+    report("euclidean_distance batch", num_points,
+        time_seconds(repetitions, [&]() {
+            utils::euclidean_distance(a, b, &output);
+            checksum += output.sum();
+        }));
+    report("angle_normalization scalar", num_points,
+        time_seconds(repetitions, [&]() {
+            for (int i = 0; i < num_points; ++i) {
+                output(i) = utils::angle_normalization(angles(i));
+            }
+            checksum += output.sum();
+        }));
+    report("angle_normalization batch", num_points,
+        time_seconds(repetitions, [&]() {
+            utils::angle_normalization(angles, &output);
+            checksum += output.sum();
+        }));
+
+    std::printf("checksum %g\n", checksum);
+    return 0;
+}
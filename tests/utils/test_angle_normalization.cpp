@@ -54,6 +54,20 @@ TEST(TestSuite, AngleNormalizationIntTest) {
     EXPECT_NEAR(0.7168, result, 0.0001);
 }
 
+/// Check that batch Angle Normalization matches the scalar version
+TEST(TestSuite, AngleNormalizationBatchTest) {
+    Eigen::ArrayXd angles = Eigen::ArrayXd::LinSpaced(101, -20.0, 20.0);
+    Eigen::ArrayXd normalized;
+    utils::angle_normalization(angles, &normalized);
+    ASSERT_EQ(angles.size(), normalized.size());
+    for (int i = 0; i < angles.size(); ++i) {
+        EXPECT_DOUBLE_EQ(
+            utils::angle_normalization(angles(i)), normalized(i));
+        EXPECT_GE(normalized(i), 0.0);
+        EXPECT_LT(normalized(i), 2.0 * M_PI);
+    }
+}
+
 }  // namespace test
 }  // namespace utils
 }  // namespace libcozmo
@@ -58,6 +58,35 @@ TEST(TestSuite, EuclideanFloatTest) {
     EXPECT_NEAR(117.1525, result, 0.0001);
 }
 
+/// Check that fixed size Eigen vectors match the generic version
+TEST(TestSuite, EuclideanEigenTest) {
+    const Eigen::Vector2d a2(10.0, 16.4);
+    const Eigen::Vector2d b2(100.0, 15.2);
+    EXPECT_NEAR(90.0080, utils::euclidean_distance(a2, b2), 0.0001);
+    const Eigen::Vector3d a3(10.0, 16.4, 5.7);
+    const Eigen::Vector3d b3(100.0, 15.2, 0.0);
+    EXPECT_NEAR(90.1883, utils::euclidean_distance(a3, b3), 0.0001);
+}
+
+/// Check that batch Euclidean distances match the pairwise distances
+TEST(TestSuite, EuclideanBatchTest) {
+    Eigen::ArrayXXd a(37, 3);
+    Eigen::ArrayXXd b(37, 3);
+    for (int i = 0; i < a.rows(); ++i) {
+        a.row(i) << i, -0.5 * i, 0.25 * i * i;
+        b.row(i) << 3.0 - i, 2.0, i % 5;
+    }
+    Eigen::ArrayXd distances;
+    utils::euclidean_distance(a, b, &distances);
+    ASSERT_EQ(a.rows(), distances.size());
+    for (int i = 0; i < a.rows(); ++i) {
+        const std::vector<double> point_a{a(i, 0), a(i, 1), a(i, 2)};
+        const std::vector<double> point_b{b(i, 0), b(i, 1), b(i, 2)};
+        EXPECT_NEAR(
+            utils::euclidean_distance(point_a, point_b), distances(i), 1e-9);
+    }
+}
+
 }  // namespace test
 }  // namespace utils
 }  // namespace libcozmo
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include "utils/HeadingTable.hpp"
+
+namespace libcozmo {
+namespace utils {
+namespace test {
+
+/// Check that the table holds the headings of every bin
+TEST(TestSuite, HeadingTableValuesTest) {
+    const auto table = HeadingTable::get(8);
+    ASSERT_EQ(8, table->size());
+    EXPECT_DOUBLE_EQ(M_PI / 4, table->bin_size());
+    for (int i = 0; i < table->size(); ++i) {
+        const double angle = i * (2 * M_PI / 8);
+        EXPECT_EQ(angle, table->angle(i));
+        EXPECT_DOUBLE_EQ(std::cos(angle), table->cos(i));
+        EXPECT_DOUBLE_EQ(std::sin(angle), table->sin(i));
+        EXPECT_NEAR(
+            std::atan2(std::sin(angle), std::cos(angle)),
+            table->signed_angle(i),
+            1e-12);
+    }
+    EXPECT_DOUBLE_EQ(M_PI, table->signed_angle(4));
+    EXPECT_DOUBLE_EQ(-M_PI / 4, table->signed_angle(7));
+}
+
+/// Check that bins outside of [0, size) wrap around
+TEST(TestSuite, HeadingTableWrapTest) {
+    const auto table = HeadingTable::get(8);
+    EXPECT_EQ(7, table->wrap(-1));
+    EXPECT_EQ(0, table->wrap(16));
+    EXPECT_EQ(table->angle(3), table->angle(11));
+    EXPECT_EQ(table->cos(5), table->cos(-3));
+}
+
+/// Check that tables are shared per bin count
+TEST(TestSuite, HeadingTableSharedTest) {
+    EXPECT_EQ(HeadingTable::get(16), HeadingTable::get(16));
+    EXPECT_NE(HeadingTable::get(16), HeadingTable::get(32));
+    EXPECT_THROW(HeadingTable::get(0), std::invalid_argument);
+}
+
+}  // namespace test
+}  // namespace utils
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////////////////////////
+// Copyright (c) 2019, Vinitha Ranganeni
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+//     1. Redistributions of source code must retain the above copyright notice
+//        this list of conditions and the following disclaimer.
+//     2. Redistributions in binary form must reproduce the above copyright
+//        notice, this list of conditions and the following disclaimer in the
+//        documentation and/or other materials provided with the distribution.
+//     3. Neither the name of the copyright holder nor the names of its
+//        contributors may be used to endorse or promote products derived from
+//        this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+#include "utils/ThreadPool.hpp"
+
+namespace libcozmo {
+namespace utils {
+namespace test {
+
+/// Every index is visited exactly once
+TEST(ThreadPoolTest, ParallelForTest) {
+    ThreadPool pool(4);
+    EXPECT_EQ(4, pool.size());
+
+    std::vector<int> visits(1000, 0);
+    pool.parallel_for(visits.size(), [&visits](int i) { visits[i]++; });
+    for (const int& count : visits) {
+        EXPECT_EQ(1, count);
+    }
+
+    // No tasks is a no-op
+    pool.parallel_for(0, [](int) { FAIL(); });
+}
+
+/// Nested calls from within a task do not deadlock
+TEST(ThreadPoolTest, NestedParallelForTest) {
+    ThreadPool pool(2);
+    std::atomic<int> count(0);
+    pool.parallel_for(8, [&pool, &count](int) {
+        pool.parallel_for(8, [&count](int) { count++; });
+    });
+    EXPECT_EQ(64, count);
+}
+
+/// Exceptions thrown by tasks reach the caller after every task ran
+TEST(ThreadPoolTest, ParallelForExceptionTest) {
+    ThreadPool pool(4);
+    std::atomic<int> count(0);
+    EXPECT_THROW(
+        pool.parallel_for(100, [&count](int i) {
+            count++;
+            if (i % 10 == 0) {
+                throw std::runtime_error("task failed");
+            }
+        }),
+        std::runtime_error);
+    EXPECT_EQ(100, count);
+
+    // The pool is still usable afterwards
+    pool.parallel_for(10, [&count](int) { count++; });
+    EXPECT_EQ(110, count);
+}
+
+/// Submitted tasks run and complete their futures
+TEST(ThreadPoolTest, SubmitTest) {
+    ThreadPool pool(2);
+    std::atomic<int> count(0);
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < 10; ++i) {
+        futures.push_back(pool.submit([&count]() { count++; }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+    EXPECT_EQ(10, count);
+}
+
+}  // namespace test
+}  // namespace utils
+}  // namespace libcozmo
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}